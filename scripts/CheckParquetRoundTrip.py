@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# ----------------------------------------------------------------------------
+# 'CheckParquetRoundTrip.py'
+# Derek Anderson
+# 10.15.2026
+#
+# Reads back the parquet files written by SCorrelatorJetTreeMaker
+# (SetParquetOutput) and checks every event, jet, and constituent
+# value against the corresponding (legacy layout) TTree in the
+# ROOT output of the same job. Needs uproot, awkward, pyarrow,
+# and numpy.
+#
+# Usage:
+#   ./CheckParquetRoundTrip.py -r output.root -p output -t RecoJetTree
+# ----------------------------------------------------------------------------
+
+import sys
+import argparse
+import numpy as np
+import awkward as ak
+import pyarrow.parquet as pq
+import uproot
+
+parser = argparse.ArgumentParser(description='Check parquet output against the jet trees')
+parser.add_argument('-r', '--rootFile', default='output.root', help='ROOT output of the job')
+parser.add_argument('-p', '--parquetBase', default='output', help='Base name passed to SetParquetOutput')
+parser.add_argument('-t', '--tree', default='RecoJetTree', help='Tree to check (RecoJetTree[_tag] or TruthJetTree[_tag])')
+parser.add_argument('--tolerance', default=0., type=float, help='Allowed relative difference (non-zero if trees were written as floats)')
+args = parser.parse_args()
+
+# parquet files are named '<base>_RecoJets[_tag]_*.parquet' or '<base>_TruthJets[_tag]_*.parquet'
+isTruth = args.tree.startswith('TruthJetTree')
+prefix  = 'TruthJetTree' if isTruth else 'RecoJetTree'
+base    = args.parquetBase + ('_TruthJets' if isTruth else '_RecoJets') + args.tree[len(prefix):]
+
+events = pq.read_table(base + '_events.parquet').to_pydict()
+jets   = pq.read_table(base + '_jets.parquet').to_pydict()
+csts   = pq.read_table(base + '_csts.parquet').to_pydict()
+tree   = uproot.open(args.rootFile)[args.tree].arrays(library='ak')
+
+# tree branch <--> parquet column
+evtColumns = {'EvtNumJets' : 'nJets', 'EvtVtxX' : 'vtxX', 'EvtVtxY' : 'vtxY', 'EvtVtxZ' : 'vtxZ'}
+jetColumns = {'JetID' : 'jetID', 'JetNumCst' : 'nCst', 'JetEnergy' : 'ene', 'JetPt' : 'pt', 'JetEta' : 'eta', 'JetPhi' : 'phi', 'JetArea' : 'area'}
+cstColumns = {'CstZ' : 'z', 'CstDr' : 'dr', 'CstEnergy' : 'ene', 'CstPt' : 'pt', 'CstEta' : 'eta', 'CstPhi' : 'phi'}
+if isTruth:
+  evtColumns.update({'EvtNumChrgPars' : 'nChrgPars', 'EvtSumParEne' : 'eSumPar', 'Parton3_ID' : 'parton3ID', 'Parton4_ID' : 'parton4ID',
+                     'Parton3_MomX' : 'parton3PX', 'Parton3_MomY' : 'parton3PY', 'Parton3_MomZ' : 'parton3PZ',
+                     'Parton4_MomX' : 'parton4PX', 'Parton4_MomY' : 'parton4PY', 'Parton4_MomZ' : 'parton4PZ'})
+  cstColumns.update({'CstID' : 'cstID', 'CstEmbedID' : 'embedID'})
+else:
+  evtColumns.update({'EvtNumTrks' : 'nTrks', 'EvtSumECalEne' : 'eSumECal', 'EvtSumHCalEne' : 'eSumHCal'})
+  cstColumns.update({'CstMatchID' : 'matchID'})
+
+nFailed = 0
+def Compare(level, branch, column, reference, values):
+  global nFailed
+  reference = np.asarray(reference, dtype=np.float64)
+  values    = np.asarray(values,    dtype=np.float64)
+  if reference.shape != values.shape:
+    print('    {} {} --> {}: MISMATCH in no. of values ({} vs. {})'.format(level, branch, column, len(reference), len(values)))
+    nFailed += 1
+    return
+  diff   = np.abs(values - reference)
+  allow  = args.tolerance * np.abs(reference)
+  nBad   = int(np.count_nonzero(diff > allow))
+  maxAbs = float(diff.max()) if len(diff) > 0 else 0.
+  print('    {} {} --> {}: max |diff| = {}, no. bad = {}'.format(level, branch, column, maxAbs, nBad))
+  if nBad > 0:
+    nFailed += 1
+
+print('\n  Checking {} against {}_*.parquet ({} entries):'.format(args.tree, base, len(tree)))
+
+# join keys: events are numbered by tree entry, jets by (evtID, jetID)
+nJetsPerEvt = ak.num(tree['JetEnergy'])
+nCstsPerJet = ak.flatten(ak.num(tree['CstEnergy'], axis=2))
+Compare('key', 'entry', 'evtID', np.arange(len(tree)), events['evtID'])
+Compare('key', 'entry', 'jets.evtID', np.repeat(np.arange(len(tree)), nJetsPerEvt), jets['evtID'])
+Compare('key', 'entry', 'csts.evtID', np.repeat(np.repeat(np.arange(len(tree)), nJetsPerEvt), nCstsPerJet), csts['evtID'])
+Compare('key', 'JetID', 'csts.jetID', np.repeat(ak.flatten(tree['JetID']), nCstsPerJet), csts['jetID'])
+
+# values
+for branch, column in evtColumns.items():
+  Compare('event', branch, column, tree[branch], events[column])
+for branch, column in jetColumns.items():
+  Compare('jet', branch, column, ak.flatten(tree[branch]), jets[column])
+for branch, column in cstColumns.items():
+  Compare('cst', branch, column, ak.flatten(tree[branch], axis=None), csts[column])
+
+if nFailed > 0:
+  print('\n  FAILED: {} columns differ!\n'.format(nFailed))
+  sys.exit(1)
+print('\n  OK: parquet output matches {}.\n'.format(args.tree))
@@ -18,6 +18,7 @@
 #include "SCorrelatorJetTreeMaker.jet.h"
 #include "SCorrelatorJetTreeMaker.cst.h"
 #include "SCorrelatorJetTreeMaker.sys.h"
+#include "SCorrelatorJetTreeMaker.mt.h"
 
 using namespace std;
 using namespace fastjet;
@@ -62,22 +63,8 @@ namespace SColdQcdCorrelatorAnalysis {
       m_evalStack = NULL;
       m_trackEval = NULL;
     }
-    if (m_trueJetDef) {
-      delete m_trueJetDef;
-      m_trueJetDef = NULL;
-    }
-    if (m_recoJetDef) {
-      delete m_recoJetDef;
-      m_recoJetDef = NULL;
-    }
-    if (m_trueClust) {
-      delete m_trueClust;
-      m_trueClust = NULL;
-    }
-    if (m_recoClust) {
-      delete m_recoClust;
-      m_recoClust = NULL;
-    }
+    m_trueClusterers.clear();
+    m_recoClusterers.clear();
 
   }  // end dtor
 
@@ -97,22 +84,71 @@ namespace SColdQcdCorrelatorAnalysis {
     if (!m_outFile) {
       cerr << "PANIC: couldn't open SCorrelatorJetTreeMaker output file!" << endl;
     }
+    m_writeConfig.Apply(m_outFile);
 
     // create node for jet-tree
     if (m_saveDST) {
       CreateJetNode(topNode);
     }
 
-    // initialize QA histograms/tuples, output trees, and functions
+    // turn on stage timing if needed
+    m_monitor.SetEnabled(m_doTiming);
+    m_trueMonitor.SetEnabled(m_doTiming);
+
+    // concurrent jet finding (reco/truth in parallel, or batch workers)
+    // needs fastjet >= 3.4 configured with --enable-thread-safety;
+    // otherwise fall back on serial jet finding
+#ifndef FASTJET_HAVE_THREAD_SAFETY
+    if (m_doParallelJets || (m_nBatchThreads > 0)) {
+      cerr << "SCorrelatorJetTreeMaker::Init(PHCompositeNode*) WARNING: fastjet was built without thread safety, turning off parallel jet finding and batch mode!" << endl;
+      m_doParallelJets = false;
+      m_nBatchThreads  = 0;
+    }
+#endif
+
+    // print the fastjet banner now so that its static state is set
+    // before any cluster sequences are built concurrently
+    ClusterSequence::print_banner();
+
+    // make sure root is ready for concurrent jet finding
+    if (m_doParallelJets) {
+      ROOT::EnableThreadSafety();
+    }
+
+    // initialize jet finders, QA histograms/tuples, output trees, and functions
+    InitJetFinders();
     InitHists();
     InitTrees();
     InitFuncs();
+
+    // start worker pool and/or output writer if needed
+    if ((m_nBatchThreads > 0) || m_doAsyncWrite) {
+      StartBatch();
+    }
     return Fun4AllReturnCodes::EVENT_OK;
 
   }  // end 'Init(PHcompositeNode*)'
 
 
 
+  int SCorrelatorJetTreeMaker::InitRun(PHCompositeNode* topNode) {
+
+    // print debug statement
+    if (m_doDebug || (Verbosity() > 1)) {
+      cout << "SCorrelatorJetTreeMaker::InitRun(PHCompositeNode*) Initializing run..." << endl;
+    }
+
+    // dead tpc sectors can change run by run
+    if (m_maskTpcSectors && !m_tpcDeadSectors.IsEmpty()) {
+      const int runNum = recoConsts::instance() -> get_IntFlag("RUNNUMBER");
+      UpdateDeadTpcSectors(runNum);
+    }
+    return Fun4AllReturnCodes::EVENT_OK;
+
+  }  // end 'InitRun(PHCompositeNode*)'
+
+
+
   int SCorrelatorJetTreeMaker::process_event(PHCompositeNode* topNode) {
 
     // print debug statement
@@ -120,51 +156,101 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::process_event(PHCompositeNode*) Processing Event..." << endl;
     }
 
+    // time whole event
+    Monitor::Timer evtTimer(m_monitor, Monitor::STAGE::EVENT);
+    m_monitor.Count(Monitor::COUNT::NEVT);
+
     // reset event-wise variables & members
     ResetVariables();
 
+    // grab only the vertex first so rejected events skip the rest
+    {
+      Monitor::Timer timer(m_monitor, Monitor::STAGE::VERTEX);
+      GetEventVertex(topNode);
+    }
+
+    // check if reconstructed vertex is in in acceptance
+    bool isGoodEvt = true;
+    if (m_doVtxCut) {
+      isGoodEvt = IsGoodVertex(m_recoVtx);
+    }
+
+    // if event is bad, exit before any evaluator or event-wise work
+    if (!isGoodEvt) {
+      m_monitor.Count(Monitor::COUNT::NEVT_EARLY_EXIT);
+      m_monitor.Count(Monitor::COUNT::NSTAGE_SKIPPED, Monitor::GetNStageAfterVertex(m_isMC));
+      CheckMemoryUsage();
+      return Fun4AllReturnCodes::DISCARDEVENT;
+    }
+    m_monitor.Count(Monitor::COUNT::NEVT_ACCEPT);
+
     // initialize evaluator & determine subevts to grab for event
     if (m_isMC) {
+      Monitor::Timer timer(m_monitor, Monitor::STAGE::EVALS);
       InitEvals(topNode);
       DetermineEvtsToGrab(topNode);
     }
 
     // get event-wise variables
-    GetEventVariables(topNode);
+    {
+      Monitor::Timer timer(m_monitor, Monitor::STAGE::EVTVARS);
+      GetEventVariables(topNode);
+    }
     if (m_isMC) {
+      Monitor::Timer timer(m_monitor, Monitor::STAGE::PARTONS);
       GetPartonInfo(topNode);
     }
 
-    // check if reconstructed vertex is in in acceptance
-    bool isGoodEvt = true;
-    if (m_doVtxCut) {
-      isGoodEvt = IsGoodVertex(m_recoVtx);
+    // in batch mode, only collect constituents here and hand
+    // clustering and output off to the worker pool
+    if (m_nBatchThreads > 0) {
+      CollectRecoCsts(topNode);
+      if (m_isMC) {
+        CollectTrueCsts(topNode, m_monitor);
+      }
+      SubmitSnapshot();
+      CheckMemoryUsage();
+      return Fun4AllReturnCodes::EVENT_OK;
     }
 
-    // set event status
-    int eventStatus = Fun4AllReturnCodes::EVENT_OK;
-    if (m_doVtxCut && !isGoodEvt) {
-      eventStatus = Fun4AllReturnCodes::DISCARDEVENT;
+    // find jets: reco and truth jet finding write disjoint members
+    // and QA histograms (marked in SCorrelatorJetTreeMaker.h), and
+    // only read the node tree, so they can run concurrently
+    if (m_isMC && m_doParallelJets) {
+      future<void> trueJets = async(launch::async, &SCorrelatorJetTreeMaker::FindTrueJets, this, topNode);
+      FindRecoJets(topNode);
+      trueJets.get();
     } else {
-      eventStatus = Fun4AllReturnCodes::EVENT_OK;
-    }
-
-    // if event is good, continue processing
-    if (isGoodEvt) {
-
-      // find jets
       FindRecoJets(topNode);
       if (m_isMC) {
         FindTrueJets(topNode);
       }
+    }
 
-      // fill output trees
-      FillRecoTree();
+    // fill output trees: either hand the event to the
+    // writer thread or fill them here
+    if (IsAsyncWrite()) {
+      SubmitRecord();
+      CheckMemoryUsage();
+      return Fun4AllReturnCodes::EVENT_OK;
+    }
+    for (size_t iCfg = 0; iCfg < m_jetConfigs.size(); iCfg++) {
+      if (DoJetMatching()) {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::MATCH);
+        m_jetMatcher.Match(m_recoClusterers[iCfg].GetJets(), m_trueClusterers[iCfg].GetJets(), m_recoProv.matchID, m_trueProv.matchID);
+      }
+      FillRecoTree(iCfg);
+      if (!m_trkVariations.empty()) {
+        FillVariationTrees(iCfg);
+      }
       if (m_isMC) {
-        FillTrueTree();
+        FillTrueTree(iCfg);
       }
     }
-    return eventStatus;
+
+    // keep track of memory footprint
+    CheckMemoryUsage();
+    return Fun4AllReturnCodes::EVENT_OK;
 
   }  // end 'process_event(PHCompositeNode*)'
 
@@ -177,6 +263,25 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::End(PHCompositeNode*) This is the End..." << endl;
     }
 
+    // report steady-state memory usage
+    if ((m_doDebug || (Verbosity() > 0)) && (m_nEvtProcessed >= CONST::NEvtWarmUp)) {
+      m_memLast = GetResidentMemory();
+      const long memGrowth = m_memLast - m_memWarmUp;
+      cout << "SCorrelatorJetTreeMaker::End(PHCompositeNode*) Memory usage:\n"
+           << "  resident memory after " << CONST::NEvtWarmUp << " events = " << m_memWarmUp << " kB\n"
+           << "  resident memory after " << m_nEvtProcessed << " events = " << m_memLast << " kB\n"
+           << "  growth since warm-up = " << memGrowth << " kB"
+           << endl;
+    }
+
+    // flush any events still being processed or written
+    if ((m_nBatchThreads > 0) || m_doAsyncWrite) {
+      StopBatch();
+    }
+
+    // collect truth timing and counters
+    m_monitor.Merge(m_trueMonitor);
+
     // save output and close
     SaveOutput();
     m_outFile -> cd();
@@ -20,91 +20,289 @@ namespace SColdQcdCorrelatorAnalysis {
 
   // constituent methods ------------------------------------------------------
 
-  bool SCorrelatorJetTreeMaker::IsGoodParticle(HepMC::GenParticle* par, const bool ignoreCharge) {
+  bool SCorrelatorJetTreeMaker::IsGoodParticle(const size_t iPar) {
 
     // print debug statement
     if (m_doDebug && (Verbosity() > 1)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodParticle(HepMC::GenParticle*) Checking if MC particle is good..." << endl;
+      cout << "SCorrelatorJetTreeMaker::IsGoodParticle(size_t) Checking if MC particle is good..." << endl;
     }
 
     // check charge if needed
-    const bool isJetCharged  = (m_jetType != 1);
-    const bool doChargeCheck = (isJetCharged && !ignoreCharge);
-
-    int   parID;
-    bool  isGoodCharge;
-    float parChrg;
-    if (doChargeCheck) {
-      parID        = par -> pdg_id();
-      parChrg      = GetParticleCharge(parID);
-      isGoodCharge = (parChrg != 0.);
-    } else {
-      isGoodCharge = true;
-    }
+    const bool isJetCharged = (m_jetType != 1);
+    const bool isGoodCharge = isJetCharged ? (m_parTable.charge[iPar] != 0.) : true;
 
-    const double parEta       = par -> momentum().eta();
-    const double parPx        = par -> momentum().px();
-    const double parPy        = par -> momentum().py();
-    const double parPt        = sqrt((parPx * parPx) + (parPy * parPy));
+    const double parPt        = m_parTable.pt[iPar];
+    const double parEta       = m_parTable.eta[iPar];
     const bool   isInPtRange  = ((parPt  > m_parPtRange[0])  && (parPt  < m_parPtRange[1]));
     const bool   isInEtaRange = ((parEta > m_parEtaRange[0]) && (parEta < m_parEtaRange[1]));
     const bool   isGoodPar    = (isGoodCharge && isInPtRange && isInEtaRange);
     return isGoodPar;
 
-  }  // end 'IsGoodParticle(HepMC::GenParticle*, bool)'
+  }  // end 'IsGoodParticle(size_t)'
+
+
+
+  void SCorrelatorJetTreeMaker::FillParticleTable(PHCompositeNode* topNode) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillParticleTable(PHCompositeNode*) Extracting final-state particle features..." << endl;
+    }
+
+    // clear table from previous event
+    m_parTable.Reset();
+
+    // grab relevant subevents and reserve
+    // space for all of them at once
+    size_t                   nParTotal = 0;
+    vector<HepMC::GenEvent*> mcEvts;
+    mcEvts.reserve(m_vecEvtsToGrab.size());
+    for (const int evtToGrab : m_vecEvtsToGrab) {
+      mcEvts.push_back( GetMcEvent(topNode, evtToGrab) );
+      nParTotal += mcEvts.back() -> particles_size();
+    }
+    m_parTable.Reserve(nParTotal);
+
+    // loop over relevant subevents
+    for (size_t iEvt = 0; iEvt < m_vecEvtsToGrab.size(); iEvt++) {
 
+      // grab subevent and embedding ID
+      HepMC::GenEvent* mcEvt   = mcEvts[iEvt];
+      const int        embedID = GetEmbedID(topNode, m_vecEvtsToGrab[iEvt]);
 
+      // loop over final-state particles
+      for (HepMC::GenEvent::particle_const_iterator itPar = mcEvt -> particles_begin(); itPar != mcEvt -> particles_end(); ++itPar) {
+        if ((*itPar) -> status() != 1) {
+          continue;
+        }
 
-  bool SCorrelatorJetTreeMaker::IsGoodTrack(SvtxTrack* track, PHCompositeNode* topNode) {
+        // read momentum once
+        const HepMC::FourVector& parMom = (*itPar) -> momentum();
+        const size_t             iPar   = m_parTable.AddRow(parMom.px(), parMom.py(), parMom.pz(), parMom.e(), parMom.eta());
+
+        const int parPdg         = (*itPar) -> pdg_id();
+        m_parTable.pdg[iPar]     = parPdg;
+        m_parTable.charge[iPar]  = m_chrgTable.Get(parPdg);
+        m_parTable.barcode[iPar] = (*itPar) -> barcode();
+        m_parTable.embedID[iPar] = embedID;
+      }  // end particle loop
+    }  // end subevent loop
+    return;
+
+  }  // end 'FillParticleTable(PHCompositeNode*)'
+
+
+
+  void SCorrelatorJetTreeMaker::SelectParticles() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::SelectParticles() Applying particle cuts..." << endl;
+    }
+
+    // apply cuts to all particles at once
+    const size_t nPar = m_parTable.Size();
+    m_parSelector.Select(m_parTable);
+
+    // in debug mode, cross-check against scalar selection
+    if (m_doDebug) {
+      for (size_t iPar = 0; iPar < nPar; iPar++) {
+        if (m_parSelector.IsAccepted(iPar) != IsGoodParticle(iPar)) {
+          cerr << "SCorrelatorJetTreeMaker::SelectParticles() WARNING: batch and scalar selection disagree for particle " << m_parTable.barcode[iPar] << "!" << endl;
+        }
+      }
+    }
+    return;
+
+  }  // end 'SelectParticles()'
+
+
+
+  SCorrelatorJetTreeMakerParticleCuts SCorrelatorJetTreeMaker::GetParticleCuts() {
+
+    SCorrelatorJetTreeMakerParticleCuts cuts;
+    cuts.doChargeCut = (m_jetType != 1);
+    cuts.ptRange     = make_pair(m_parPtRange[0],  m_parPtRange[1]);
+    cuts.etaRange    = make_pair(m_parEtaRange[0], m_parEtaRange[1]);
+    return cuts;
+
+  }  // end 'GetParticleCuts()'
+
+
+
+  void SCorrelatorJetTreeMaker::FillTrackTable(PHCompositeNode* topNode) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillTrackTable(PHCompositeNode*) Extracting track features..." << endl;
+    }
+
+    // clear table from previous event
+    m_trkTable.Reset();
+
+    // the primary-vertex flag is only looked up if the
+    // nominal cuts or any variation use it
+    bool needPrimVtx = m_useOnlyPrimVtx;
+    for (const SCorrelatorJetTreeMakerTrackCutVariation& variation : m_trkVariations) {
+      needPrimVtx |= variation.cuts.useOnlyPrimVtx;
+    }
+
+    // loop over tracks
+    SvtxTrack*    track   = NULL;
+    SvtxTrackMap* mapTrks = GetTrackMap(topNode);
+    m_trkTable.Reserve(mapTrks -> size());
+    for (SvtxTrackMap::Iter itTrk = mapTrks -> begin(); itTrk != mapTrks -> end(); ++itTrk) {
+
+      // get track
+      track = itTrk -> second;
+      if (!track) {
+        continue;
+      }
+
+      // grab track dca and vertex
+      const pair<double, double> trkDca = GetTrackDcaPair(track, topNode);
+      const CLHEP::Hep3Vector    trkVtx = GetTrackVertex(track, topNode);
+
+      // grab track momentum
+      const double trkPx = track -> get_px();
+      const double trkPy = track -> get_py();
+      const double trkPz = track -> get_pz();
+      const double trkE  = sqrt((trkPx * trkPx) + (trkPy * trkPy) + (trkPz * trkPz) + (0.140 * 0.140));  // FIXME move pion mass to constant in utilities namespace
+
+      // evaluate each feature exactly once
+      const size_t iRow = m_trkTable.AddRow();
+      m_trkTable.pt[iRow]            = track -> get_pt();
+      m_trkTable.eta[iRow]           = track -> get_eta();
+      m_trkTable.phi[iRow]           = track -> get_phi();
+      m_trkTable.px[iRow]            = trkPx;
+      m_trkTable.py[iRow]            = trkPy;
+      m_trkTable.pz[iRow]            = trkPz;
+      m_trkTable.ene[iRow]           = trkE;
+      m_trkTable.quality[iRow]       = track -> get_quality();
+      m_trkTable.dcaXY[iRow]         = trkDca.first;
+      m_trkTable.dcaZ[iRow]          = trkDca.second;
+      m_trkTable.deltaPt[iRow]       = GetTrackDeltaPt(track);
+      m_trkTable.nMvtx[iRow]         = GetNumLayer(track, SUBSYS::MVTX);
+      m_trkTable.nIntt[iRow]         = GetNumLayer(track, SUBSYS::INTT);
+      m_trkTable.nTpc[iRow]          = GetNumLayer(track, SUBSYS::TPC);
+      m_trkTable.hasSiSeed[iRow]     = (track -> get_silicon_seed() != NULL);
+      m_trkTable.hasTpcSeed[iRow]    = (track -> get_tpc_seed() != NULL);
+      m_trkTable.isFromPrimVtx[iRow] = needPrimVtx ? IsFromPrimaryVtx(track, topNode) : true;
+      m_trkTable.vtxID[iRow]         = track -> get_vertex_id();
+      m_trkTable.vtxX[iRow]          = trkVtx.x();
+      m_trkTable.vtxY[iRow]          = trkVtx.y();
+      m_trkTable.vtxZ[iRow]          = trkVtx.z();
+      m_trkTable.trkID[iRow]         = track -> get_id();
+    }  // end track loop
+    return;
+
+  }  // end 'FillTrackTable(PHCompositeNode*)'
+
+
+
+  void SCorrelatorJetTreeMaker::SelectTracks() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::SelectTracks() Applying track cuts..." << endl;
+    }
+
+    // apply cuts to all tracks at once
+    const size_t nTrk = m_trkTable.Size();
+    m_trkSelector.Select(m_trkTable);
+
+    // in debug mode, cross-check against scalar selection
+    // (which scans the tpc sectors without the lookup table)
+    if (m_doDebug) {
+      for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+        if (m_trkSelector.IsAccepted(iTrk) != IsGoodTrack(iTrk)) {
+          cerr << "SCorrelatorJetTreeMaker::SelectTracks() WARNING: batch and scalar selection disagree for track " << m_trkTable.trkID[iTrk] << "!" << endl;
+        }
+      }
+    }
+    return;
+
+  }  // end 'SelectTracks()'
+
+
+
+  SCorrelatorJetTreeMakerTrackCuts SCorrelatorJetTreeMaker::GetTrackCuts() {
+
+    SCorrelatorJetTreeMakerTrackCuts cuts;
+    cuts.requireSiSeeds = m_requireSiSeeds;
+    cuts.doVtxCut       = m_doVtxCut;
+    cuts.useOnlyPrimVtx = m_useOnlyPrimVtx;
+    cuts.doDcaSigmaCut  = m_doDcaSigmaCut;
+    cuts.maskTpcSectors = m_maskTpcSectors;
+    cuts.vzRange        = make_pair(m_evtVzRange[0],      m_evtVzRange[1]);
+    cuts.vrRange        = make_pair(m_evtVrRange[0],      m_evtVrRange[1]);
+    cuts.ptRange        = make_pair(m_trkPtRange[0],      m_trkPtRange[1]);
+    cuts.etaRange       = make_pair(m_trkEtaRange[0],     m_trkEtaRange[1]);
+    cuts.qualRange      = make_pair(m_trkQualRange[0],    m_trkQualRange[1]);
+    cuts.nMvtxRange     = make_pair(m_trkNMvtxRange[0],   m_trkNMvtxRange[1]);
+    cuts.nInttRange     = make_pair(m_trkNInttRange[0],   m_trkNInttRange[1]);
+    cuts.nTpcRange      = make_pair(m_trkNTpcRange[0],    m_trkNTpcRange[1]);
+    cuts.dcaRangeXY     = make_pair(m_trkDcaRangeXY[0],   m_trkDcaRangeXY[1]);
+    cuts.dcaRangeZ      = make_pair(m_trkDcaRangeZ[0],    m_trkDcaRangeZ[1]);
+    cuts.deltaPtRange   = make_pair(m_trkDeltaPtRange[0], m_trkDeltaPtRange[1]);
+    cuts.nSigCutXY      = m_nSigCutXY;
+    cuts.nSigCutZ       = m_nSigCutZ;
+    cuts.sigDcaXY.ptMax = m_dcaPtFitMaxXY;
+    cuts.sigDcaZ.ptMax  = m_dcaPtFitMaxZ;
+    cuts.tpcSectors     = m_tpcSectorConfig;
+    for (size_t iParam = 0; iParam < cuts.sigDcaXY.par.size(); iParam++) {
+      cuts.sigDcaXY.par[iParam] = m_parSigDcaXY[iParam];
+      cuts.sigDcaZ.par[iParam]  = m_parSigDcaZ[iParam];
+    }
+    return cuts;
+
+  }  // end 'GetTrackCuts()'
+
+
+
+  bool SCorrelatorJetTreeMaker::IsGoodTrack(const size_t iTrk) {
 
     // print debug statement
     if (m_doDebug && (Verbosity() > 1)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodTrack(SvtxTrack*) Checking if track is good..." << endl;
+      cout << "SCorrelatorJetTreeMaker::IsGoodTrack(size_t) Checking if track is good..." << endl;
     }
 
     // grab track info
-    const double trkPt      = track -> get_pt();
-    const double trkEta     = track -> get_eta();
-    const double trkQual    = track -> get_quality();
-    const double trkDeltaPt = GetTrackDeltaPt(track);
-    const int    trkNMvtx   = GetNumLayer(track, SUBSYS::MVTX);
-    const int    trkNIntt   = GetNumLayer(track, SUBSYS::INTT);
-    const int    trkNTpc    = GetNumLayer(track, SUBSYS::TPC);
+    const double trkPt      = m_trkTable.pt[iTrk];
+    const double trkEta     = m_trkTable.eta[iTrk];
+    const double trkQual    = m_trkTable.quality[iTrk];
+    const double trkDeltaPt = m_trkTable.deltaPt[iTrk];
+    const int    trkNMvtx   = m_trkTable.nMvtx[iTrk];
+    const int    trkNIntt   = m_trkTable.nIntt[iTrk];
+    const int    trkNTpc    = m_trkTable.nTpc[iTrk];
 
     // grab track dca
-    const auto   trkDca   = GetTrackDcaPair(track, topNode);
-    const double trkDcaXY = trkDca.first;
-    const double trkDcaZ  = trkDca.second;
-
-
-    // if above max pt used to fit dca width,
-    // use value of fit at max pt
-    double ptEvalXY = (trkPt > m_dcaPtFitMaxXY) ? m_dcaPtFitMaxXY : trkPt;
-    double ptEvalZ  = (trkPt > m_dcaPtFitMaxZ)  ? m_dcaPtFitMaxZ  : trkPt;
+    const double trkDcaXY = m_trkTable.dcaXY[iTrk];
+    const double trkDcaZ  = m_trkTable.dcaZ[iTrk];
 
     // check if dca is good
     bool isInDcaRangeXY = false;
     bool isInDcaRangeZ  = false;
     if (m_doDcaSigmaCut) {
-      isInDcaRangeXY = (abs(trkDcaXY) < (m_nSigCutXY * (m_fSigDcaXY -> Eval(ptEvalXY))));
-      isInDcaRangeZ  = (abs(trkDcaZ)  < (m_nSigCutZ  * (m_fSigDcaZ  -> Eval(ptEvalZ))));
+      isInDcaRangeXY = (abs(trkDcaXY) < (m_nSigCutXY * m_trkSelector.GetCuts().sigDcaXY.Eval(trkPt)));
+      isInDcaRangeZ  = (abs(trkDcaZ)  < (m_nSigCutZ  * m_trkSelector.GetCuts().sigDcaZ.Eval(trkPt)));
     } else {
       isInDcaRangeXY = ((trkDcaXY > m_trkDcaRangeXY[0]) && (trkDcaXY < m_trkDcaRangeXY[1]));
       isInDcaRangeZ  = ((trkDcaZ  > m_trkDcaRangeZ[0])  && (trkDcaZ  < m_trkDcaRangeZ[1]));
     }  
 
-    // if applying vertex cuts, grab track
-    // vertex and check if good
+    // if applying vertex cuts, check
+    // if track vertex is good
     bool isInVtxRange = true;
     if (m_doVtxCut) {
-      CLHEP::Hep3Vector trkVtx = GetTrackVertex(track, topNode);
+      const CLHEP::Hep3Vector trkVtx(m_trkTable.vtxX[iTrk], m_trkTable.vtxY[iTrk], m_trkTable.vtxZ[iTrk]);
       isInVtxRange = IsGoodVertex(trkVtx);
     }
 
     // if using only primary vertex,
     // ignore tracks from other vertices
     if (m_useOnlyPrimVtx) {
-      const bool isFromPrimVtx = IsFromPrimaryVtx(track, topNode);
+      const bool isFromPrimVtx = m_trkTable.isFromPrimVtx[iTrk];
       if (!isFromPrimVtx) {
         isInVtxRange = false;
       }
@@ -114,11 +312,11 @@ namespace SColdQcdCorrelatorAnalysis {
     // ignore tracks near boundaries
     bool isGoodPhi = true;
     if (m_maskTpcSectors) {
-      isGoodPhi = IsGoodTrackPhi(track);
+      isGoodPhi = IsGoodTrackPhi(m_trkTable.phi[iTrk]);
     }
 
     // apply cuts
-    const bool isSeedGood       = IsGoodTrackSeed(track);
+    const bool isSeedGood       = IsGoodTrackSeed(iTrk);
     const bool isInPtRange      = ((trkPt      > m_trkPtRange[0])      && (trkPt      <  m_trkPtRange[1]));
     const bool isInEtaRange     = ((trkEta     > m_trkEtaRange[0])     && (trkEta     <  m_trkEtaRange[1]));
     const bool isInQualRange    = ((trkQual    > m_trkQualRange[0])    && (trkQual    <  m_trkQualRange[1]));
@@ -131,7 +329,7 @@ namespace SColdQcdCorrelatorAnalysis {
     const bool isGoodTrack      = (isSeedGood && isGoodPhi && isInPtRange && isInEtaRange && isInQualRange && isInNumRange && isInDcaRange && isInDeltaPtRange && isInVtxRange);
     return isGoodTrack;
 
-  }  // end 'IsGoodTrack(SvtxTrack*)'
+  }  // end 'IsGoodTrack(size_t)'
 
 
 
@@ -152,106 +350,114 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
-  bool SCorrelatorJetTreeMaker::IsGoodECal(CLHEP::Hep3Vector& hepVecECal) {
+  bool SCorrelatorJetTreeMaker::IsGoodTrackSeed(const size_t iTrk) {
 
     // print debug statement
-    if (m_doDebug && (Verbosity() > 1)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodECal(CLHEP::Hep3Vector&) Checking if ECal cluster is good..." << endl;
+    if (m_doDebug && (Verbosity() > 2)) {
+      cout << "SCorrelatorJetTreeMaker::IsGoodTrackSeed(size_t) Checking if track seed is good..." << endl;
     }
 
-    const double clustPt      = hepVecECal.perp();
-    const double clustEta     = hepVecECal.pseudoRapidity();
-    const bool   isInPtRange  = ((clustPt  > m_ecalPtRange[0])  && (clustPt  < m_ecalPtRange[1]));
-    const bool   isInEtaRange = ((clustEta > m_ecalEtaRange[0]) && (clustEta < m_ecalEtaRange[1]));
-    const bool   isGoodClust  = (isInPtRange && isInEtaRange);
-    return isGoodClust;
+    // get track seeds
+    const bool trkSiSeed  = m_trkTable.hasSiSeed[iTrk];
+    const bool trkTpcSeed = m_trkTable.hasTpcSeed[iTrk];
+
+    // check if one or both seeds are present as needed
+    bool isSeedGood = (trkSiSeed && trkTpcSeed);
+    if (!m_requireSiSeeds) {
+      isSeedGood = (trkSiSeed || trkTpcSeed);
+    }
+    return isSeedGood;
 
-  }  // end 'IsGoodECal(CLHEP::Hep3Vector&)'
+  }  // end 'IsGoodTrackSeed(size_t)'
 
 
 
-  bool SCorrelatorJetTreeMaker::IsGoodHCal(CLHEP::Hep3Vector& hepVecHCal) {
+  int SCorrelatorJetTreeMaker::GetMatchID(SvtxTrack* track) {
 
     // print debug statement
-    if (m_doDebug && (Verbosity() > 1)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodHCal(CLHEP::Hep3Vector&) Checking if HCal cluster is good..." << endl;
+    if (m_doDebug && (Verbosity() > 2)) {
+      cout << "SCorrelatorJetTreeMaker::GetMatchID(SvtxTrack*) Getting ID of matching particle..." << endl;
     }
 
-    // TODO: explore particle cuts. These should vary with particle charge/species.
-    const double clustPt      = hepVecHCal.perp();
-    const double clustEta     = hepVecHCal.pseudoRapidity();
-    const bool   isInPtRange  = ((clustPt  > m_hcalPtRange[0])  && (clustPt  < m_hcalPtRange[1]));
-    const bool   isInEtaRange = ((clustEta > m_hcalEtaRange[0]) && (clustEta < m_hcalEtaRange[1]));
-    const bool   isGoodClust  = (isInPtRange && isInEtaRange);
-    return isGoodClust;
+    // return memoized id if track was already resolved this event
+    const unsigned int trkID = track -> get_id();
+    unordered_map<unsigned int, int>::const_iterator itMatch = m_matchIDs.find(trkID);
+    if (itMatch != m_matchIDs.end()) {
+      return itMatch -> second;
+    }
+
+    // otherwise, grab barcode of particle which contributed the most clusters
+    int           matchID = -1;
+    PHG4Particle* par     = m_trackEval -> max_truth_particle_by_nclusters(track);
+    if (par) {
+      matchID = par -> get_barcode();
+    }
+    m_matchIDs[trkID] = matchID;
+    return matchID;
 
-  }  // end 'IsGoodHCal(CLHEP::Hep3Vector&)'
+  }  // end 'GetMatchID(SvtxTrack*)'
 
 
 
-  bool SCorrelatorJetTreeMaker::IsGoodTrackSeed(SvtxTrack* track) {
+  bool SCorrelatorJetTreeMaker::IsGoodTrackPhi(const double trkPhi) {
 
     // print debug statement
     if (m_doDebug && (Verbosity() > 2)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodSeedTrack(SvtxTrack*) Checking if track seed is good..." << endl;
+      cout << "SCorrelatorJetTreeMaker::IsGoodTrackPhi(double) Checking if track phi is good..." << endl;
     }
 
-    // get track seeds
-    TrackSeed* trkSiSeed  = track -> get_silicon_seed();
-    TrackSeed* trkTpcSeed = track -> get_tpc_seed();
+    // scan the sector boundaries (and any dead sectors) directly
+    // rather than going through the mask's lookup table: this is
+    // the scalar reference the batch selection is checked against
+    const SCorrelatorJetTreeMakerTpcSectorConfig& config = m_trkSelector.GetCuts().tpcSectors;
+    const double halfMaskSize = config.maskWidth / 2.;
+    const size_t nBound       = config.boundaries.size();
 
-    // check if one or both seeds are present as needed
-    bool isSeedGood = (trkSiSeed && trkTpcSeed);
-    if (!m_requireSiSeeds) {
-      isSeedGood = (trkSiSeed || trkTpcSeed);
+    // flag phi as bad if within boundary +- (maskWidth / 2),
+    // checking the copies of phi shifted by 2pi to catch
+    // intervals which wrap around phi = +-pi
+    const array<double, 3> phiCopies = {trkPhi, trkPhi - (2. * M_PI), trkPhi + (2. * M_PI)};
+
+    bool isGoodPhi = true;
+    for (const double phi : phiCopies) {
+      for (const float boundary : config.boundaries) {
+        if ((phi > (boundary - halfMaskSize)) && (phi < (boundary + halfMaskSize))) {
+          isGoodPhi = false;
+        }
+      }
+      for (const int sector : config.deadSectors) {
+        if ((sector < 0) || (sector >= (int) nBound)) {
+          continue;
+        }
+        const double lo = config.boundaries[sector];
+        const double hi = (sector + 1 < (int) nBound) ? config.boundaries[sector + 1] : config.boundaries[0] + (2. * M_PI);
+        if ((phi > (lo - halfMaskSize)) && (phi < (hi + halfMaskSize))) {
+          isGoodPhi = false;
+        }
+      }
     }
-    return isSeedGood;
+    return isGoodPhi;
 
-  }  // end 'IsGoodSeed(SvtxTrack*)'
+  }  // end 'IsGoodTrackPhi(double)'
 
 
 
-  bool SCorrelatorJetTreeMaker::IsGoodTrackPhi(SvtxTrack* track, const float phiMaskSize) {
+  void SCorrelatorJetTreeMaker::UpdateDeadTpcSectors(const int runNum) {
 
     // print debug statement
-    if (m_doDebug && (Verbosity() > 2)) {
-      cout << "SCorrelatorJetTreeMaker::IsGoodTrackPhi(SvtxTrack*) Checking if track phi is good..." << endl;
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::UpdateDeadTpcSectors(int) Updating dead TPC sectors for run " << runNum << "..." << endl;
     }
 
-    // TPC sector boundaries:
-    //   12 sectors --> ~0.523 rad/sector,
-    //   assumed to be symmetric about phi = 0
-    // FIXME move to constant in utilities namespace
-    const array<float, NTpcSector> phiSectorBoundaries = {
-      -2.877,
-      -2.354,
-      -1.831,
-      -1.308,
-      -0.785,
-      -0.262,
-      0.262,
-      0.785,
-      1.308,
-      1.831,
-      2.354,
-      2.877
-    };
-
-    // flag phi as bad if within boundary +- (phiMaskSize / 2)
-    const double halfMaskSize = phiMaskSize / 2.;
-    const double trkPhi       = track -> get_phi();
-
-    // loop over sector boundaries and check phi
-    bool isGoodPhi = true;
-    for (const float boundary : phiSectorBoundaries) {
-      if ((trkPhi > (boundary - halfMaskSize)) && (trkPhi < (boundary + halfMaskSize))) {
-        isGoodPhi = false;
-        break;
-      }
+    // nominal cuts and any variations share the same dead sectors
+    const vector<int> deadSectors = m_tpcDeadSectors.GetDeadSectors(runNum);
+    m_trkSelector.SetDeadTpcSectors(deadSectors);
+    for (SCorrelatorJetTreeMakerTrackSelector& selector : m_varSelectors) {
+      selector.SetDeadTpcSectors(deadSectors);
     }
-    return isGoodPhi;
+    return;
 
-  }  // end 'IsGoodTrackPhi(SvtxTrack*, float)'
+  }  // end 'UpdateDeadTpcSectors(int)'
 
 }  // end SColdQcdCorrelatorAnalysis namespace
 
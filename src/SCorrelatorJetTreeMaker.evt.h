@@ -40,6 +40,21 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  void SCorrelatorJetTreeMaker::GetEventVertex(PHCompositeNode* topNode) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::GetEventVertex(PHCompositeNode*) Grabbing event vertex..." << endl;
+    }
+
+    // only the vertex is needed to decide whether to keep an event
+    m_recoVtx = GetRecoVtx(topNode);
+    return;
+
+  }  // end 'GetEventVertex(PHCompositeNode*)'
+
+
+
   void SCorrelatorJetTreeMaker::GetEventVariables(PHCompositeNode* topNode) {
 
     // print debug statement
@@ -47,7 +62,7 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::GetEventVariables(PHCompositeNode*) Grabbing event info..." << endl;
     }
 
-    m_recoVtx     = GetRecoVtx(topNode);
+    // n.b. vertex is already set by GetEventVertex(PHCompositeNode*)
     m_recoNumTrks = GetNumTrks(topNode);
     m_recoSumECal = GetSumECalEne(topNode);
     m_recoSumHCal = GetSumHCalEne(topNode);
@@ -59,6 +74,33 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end 'GetEventVariables(PHCompositeNode*)'
 
+
+
+  SCorrelatorJetTreeMakerEventInfo SCorrelatorJetTreeMaker::GetEventInfo() {
+
+    // collect event-wise variables needed for output
+    SCorrelatorJetTreeMakerEventInfo info;
+    info.nTrks        = m_recoNumTrks;
+    info.eSumECal     = m_recoSumECal;
+    info.eSumHCal     = m_recoSumHCal;
+    info.recoVtxX     = m_recoVtx.x();
+    info.recoVtxY     = m_recoVtx.y();
+    info.recoVtxZ     = m_recoVtx.z();
+    info.nChrgPars    = m_trueNumChrgPars;
+    info.eSumPar      = m_trueSumPar;
+    info.trueVtxX     = m_trueVtx.x();
+    info.trueVtxY     = m_trueVtx.y();
+    info.trueVtxZ     = m_trueVtx.z();
+    info.partonID     = make_pair(m_partonID[0], m_partonID[1]);
+    info.partonPX     = make_pair(m_partonMom[0].x(), m_partonMom[1].x());
+    info.partonPY     = make_pair(m_partonMom[0].y(), m_partonMom[1].y());
+    info.partonPZ     = make_pair(m_partonMom[0].z(), m_partonMom[1].z());
+    info.recoProv     = &m_recoProv;
+    info.trueProv     = &m_trueProv;
+    return info;
+
+  }  // end 'GetEventInfo()'
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -21,12 +21,22 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <mutex>
+#include <memory>
+#include <future>
+#include <thread>
+#include <fstream>
+#include <condition_variable>
 #include <sstream>
 #include <cstdlib>
 #include <utility>
+#include <unistd.h>
+#include <unordered_map>
 // root libraries
 #include <TF1.h>
+#include <TH1.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TTree.h>
 #include <TMath.h>
 #include <TDirectory.h>
@@ -49,6 +59,7 @@
 #include <phool/PHIODataNode.h>
 #include <phool/PHNodeIterator.h>
 #include <phool/PHCompositeNode.h>
+#include <phool/recoConsts.h>
 // truth utilities
 #include <g4main/PHG4Hit.h>
 #include <g4main/PHG4Particle.h>
@@ -87,8 +98,24 @@
 #include "/sphenix/user/danderson/install/include/scorrelatorutilities/Constants.h"
 #include "/sphenix/user/danderson/install/include/scorrelatorutilities/Interfaces.h"
 // analysis definitions
-#include "SCorrelatorJetTreeMakerConfig.h"
+#include "SCorrelatorJetTreeMakerWriteConfig.h"
 #include "SCorrelatorJetTreeMakerOutput.h"
+#include "SCorrelatorJetTreeMakerClusterer.h"
+#include "SCorrelatorJetTreeMakerBackground.h"
+#include "SCorrelatorJetTreeMakerMatcher.h"
+#include "SCorrelatorJetTreeMakerTpcSectorMask.h"
+#include "SCorrelatorJetTreeMakerConfig.h"
+#include "SCorrelatorJetTreeMakerTrackTable.h"
+#include "SCorrelatorJetTreeMakerTrackSelector.h"
+#include "SCorrelatorJetTreeMakerParticleTable.h"
+#include "SCorrelatorJetTreeMakerParticleSelector.h"
+#include "SCorrelatorJetTreeMakerCaloTable.h"
+#include "SCorrelatorJetTreeMakerProvenance.h"
+#include "SCorrelatorJetTreeMakerMonitor.h"
+#include "SCorrelatorJetTreeMakerQueue.h"
+#include "SCorrelatorJetTreeMakerSnapshot.h"
+#include "SCorrelatorJetTreeMakerNTuple.h"
+#include "SCorrelatorJetTreeMakerParquet.h"
 
 #pragma GCC diagnostic pop
 
@@ -119,6 +146,11 @@ namespace SColdQcdCorrelatorAnalysis {
         ET_SCHEME  = 3,
         ET2_SCHEME = 4
       };
+      enum BACKEND {
+        TREE   = 0,
+        NTUPLE = 1,
+        BOTH   = 2
+      };
 
       // ctor/dtor
       SCorrelatorJetTreeMaker(const string& name = "SCorrelatorJetTreeMaker", const string& outFile = "correlator_jet_tree.root", const bool isMC = false, const bool isEmbed = false, const bool debug = false);
@@ -126,27 +158,62 @@ namespace SColdQcdCorrelatorAnalysis {
 
       // F4A methods
       int Init(PHCompositeNode*)          override;
+      int InitRun(PHCompositeNode*)       override;
       int process_event(PHCompositeNode*) override;
       int End(PHCompositeNode*)           override;
 
+      // setters (*.io.h)
+      void AddJetConfiguration(const double rJet, const ALGO jetAlgo, const RECOMB recombScheme);
+      void SetDoFlatOutput(const bool doFlat);
+      void SetDoTiming(const bool doTiming, const string jsonName = "");
+      void SetDoParallelJetFinding(const bool doParallel);
+      void SetBatchMode(const size_t nThreads, const size_t queueSize = 64);
+      void SetDoAsyncWrite(const bool doAsync);
+      void SetCompression(const SCorrelatorJetTreeMakerWriteConfig::COMP algo, const int level);
+      void SetBasketSize(const int size);
+      void SetAutoFlush(const long long autoFlush);
+      void SetAutoSave(const long long autoSave);
+      void SetDoFloatOutput(const bool doFloat);
+      void SetOutputPrecision(const SCorrelatorJetTreeMakerPrecision& precision);
+      void SetOutputBackend(const BACKEND backend);
+      void SetParquetOutput(const string baseName, const long long rowGroupSize = 65536);
+      void SetJetArea(const SCorrelatorJetTreeMakerAreaConfig::TYPE type, const double ghostArea = 0.01);
+      void SetBkgdSubtraction(const SCorrelatorJetTreeMakerBkgdConfig::TYPE type, const bool doCstSub = true);
+      void SetJetMatching(const bool doMatch, const double maxDr = 0.3);
+      void AddTrackCutVariation(const string name, const SCorrelatorJetTreeMakerTrackCuts& cuts);
+      void SetTpcSectorMask(const float maskWidth, const vector<int> deadSectors = {});
+      void SetTpcDeadSectorTable(const string fileName);
+
+      // getters (*.cst.h)
+      SCorrelatorJetTreeMakerTrackCuts GetTrackCuts();
+
     private:
 
+      // shorthand for stage timing
+      typedef SCorrelatorJetTreeMakerMonitor Monitor;
+
+      // jet parameter conversions (*.io.h)
+      JetAlgorithm        GetFastJetAlgo(const ALGO jetAlgo);
+      RecombinationScheme GetFastJetRecomb(const RECOMB recombScheme);
+
       // constants
       enum CONST {
-        NPart      = 2,
-        NComp      = 3,
-        NParam     = 4,
-        NRange     = 2,
-        NMoment    = 2,
-        NInfoQA    = 9,
-        NJetType   = 2,
-        NCstType   = 5,
-        NObjType   = 9,
-        NDirectory = 6,
-        NMvtxLayer = 3,
-        NInttLayer = 8,
-        NTpcLayer  = 48,
-        NTpcSector = 12
+        NPart         = 2,
+        NComp         = 3,
+        NParam        = 4,
+        NRange        = 2,
+        NMoment       = 2,
+        NInfoQA       = 9,
+        NJetType      = 2,
+        NCstType      = 5,
+        NObjType      = 9,
+        NDirectory    = 6,
+        NMvtxLayer    = 3,
+        NInttLayer    = 8,
+        NTpcLayer     = 48,
+        NTpcSector    = 12,
+        NEvtWarmUp    = 100,
+        NWriteBuffers = 2
       };
 
       // qa info & tracking subsystems
@@ -157,72 +224,178 @@ namespace SColdQcdCorrelatorAnalysis {
 
       // event methods (*.evt.h)
       bool IsGoodVertex(const CLHEP::Hep3Vector vtx);
+      void GetEventVertex(PHCompositeNode* topNode);
       void GetEventVariables(PHCompositeNode* topNode);
+      SCorrelatorJetTreeMakerEventInfo GetEventInfo();
 
       // jet methods (*.jet.h)
       void FindTrueJets(PHCompositeNode* topNode);
       void FindRecoJets(PHCompositeNode* topNode);
-      void AddParticles(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap);
-      void AddTracks(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap);
-      void AddFlow(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap);
-      void AddECal(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap);
-      void AddHCal(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap);
+      void CollectTrueCsts(PHCompositeNode* topNode, Monitor& monitor);
+      void CollectRecoCsts(PHCompositeNode* topNode);
+      void FindVariationJets(PHCompositeNode* topNode);
+      void AddParticles(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      void AddTracks(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      void AddFlow(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      void AddECal(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      void AddHCal(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      void FillCaloTable(RawClusterContainer* clustStore, const CLHEP::Hep3Vector& hepVecVtx, const pair<double, double> ptRange, const pair<double, double> etaRange);
+      double AddCaloClusters(const Jet::SRC source, const OBJECT object, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov);
+      bool DoBkgdSubtraction() const;
+      void InitBkgd();
+      double GetMaxCstEta() const;
+      bool DoJetMatching() const;
+      SCorrelatorJetTreeMakerAreaConfig GetAreaConfig(const SCorrelatorJetTreeMakerJetConfig& jetConfig);
 
       // constituent methods (*.cst.h)
-      bool IsGoodParticle(HepMC::GenParticle* par, const bool ignoreCharge = false);
-      bool IsGoodTrack(SvtxTrack* track, PHCompositeNode* topNode);
+      bool IsGoodParticle(const size_t iPar);
+      bool IsGoodTrack(const size_t iTrk);
       bool IsGoodFlow(ParticleFlowElement* flow);
-      bool IsGoodECal(CLHEP::Hep3Vector& hepVecECal);
-      bool IsGoodHCal(CLHEP::Hep3Vector& hepVecHCal);
-      bool IsGoodTrackSeed(SvtxTrack* track);
-      bool IsGoodTrackPhi(SvtxTrack* track, const float phiMaskSize = 0.01);  // FIXME make user configurable
+      bool IsGoodTrackSeed(const size_t iTrk);
+      int  GetMatchID(SvtxTrack* track);
+      bool IsGoodTrackPhi(const double trkPhi);
+      void UpdateDeadTpcSectors(const int runNum);
+      void FillTrackTable(PHCompositeNode* topNode);
+      void SelectTracks();
+      void FillParticleTable(PHCompositeNode* topNode);
+      void SelectParticles();
+      SCorrelatorJetTreeMakerParticleCuts GetParticleCuts();
 
       // system methods (*.sys.h)
       void InitVariables();
       void InitHists();
       void InitTrees();
       void InitFuncs();
+      void InitJetFinders();
       void InitEvals(PHCompositeNode* topNode);
-      void FillTrueTree();
-      void FillRecoTree();
+      void FillTrueTree(const size_t iCfg);
+      void FillRecoTree(const size_t iCfg);
+      void FillVariationTrees(const size_t iCfg);
+      template <typename TOutput> void FillTrueOutput(const vector<PseudoJet>& trueJets, const SCorrelatorJetTreeMakerEventInfo& info, TOutput& output, const bool doQA);
+      template <typename TOutput> void FillRecoOutput(const vector<PseudoJet>& recoJets, const SCorrelatorJetTreeMakerEventInfo& info, const SCorrelatorJetTreeMakerBkgdEstimator* bkgd, TOutput& output, const bool doQA);
+      template <typename TOutput, typename TEvent> int FillTree(TTree* tree, SCorrelatorJetTreeMakerNTupleWriter<TEvent>* ntuple, SCorrelatorJetTreeMakerParquetSink<TEvent>* parquet, TOutput& output);
       void SaveOutput();
+      void SaveMonitor();
       void ResetVariables();
       void DetermineEvtsToGrab(PHCompositeNode* topNode);
+      void CheckMemoryUsage();
       int  CreateJetNode(PHCompositeNode* topNode);
+      long GetResidentMemory();
+
+      // batch-mode methods (*.mt.h)
+      void   StartBatch();
+      void   StopBatch();
+      void   SubmitSnapshot();
+      void   SubmitRecord();
+      void   RunBatchWorker(const size_t iThread);
+      void   RunBatchWriter();
+      void   WriteRecord(SCorrelatorJetTreeMakerEventRecord& record, Monitor& monitor);
+      size_t FillCstQA(TH1* hist, const vector<double>& values);
+      size_t FillCstQA(TH1* hist, const vector<vector<double>>& values);
+      bool   IsAsyncWrite() const;
+      template <typename TOutput> void FillJetQA(const TOutput& output, const bool isTruth);
 
       // F4A/utility members
       Fun4AllHistoManager* m_histMan   = NULL;
-      SvtxEvalStack*       m_evalStack = NULL;
-      SvtxTrackEval*       m_trackEval = NULL;
+      SvtxEvalStack*       m_evalStack = NULL;  // built before jet finding
+      SvtxTrackEval*       m_trackEval = NULL;  // reco path only
+      unordered_map<unsigned int, int> m_matchIDs;  // reco path only
+      Monitor              m_monitor;      // reco path only while jets are found in parallel
+      Monitor              m_trueMonitor;  // truth path only, merged into m_monitor in End
 
-      // io members
-      TFile*    m_outFile     = NULL;
-      TTree*    m_recoTree    = NULL;
-      TTree*    m_trueTree    = NULL;
-      JetMapv1* m_recoJetMap  = NULL;
-      JetMapv1* m_trueJetMap  = NULL;
+      // io members (used only by the writer thread between
+      // StartBatch and StopBatch, see StartBatch)
+      TFile*                                           m_outFile    = NULL;
+      JetMapv1*                                        m_recoJetMap = NULL;
+      JetMapv1*                                        m_trueJetMap = NULL;
+      vector<TTree*>                                   m_recoTrees;
+      vector<TTree*>                                   m_trueTrees;
+      vector<SCorrelatorJetTreeMakerLegacyRecoOutput>  m_recoOutputs;
+      vector<SCorrelatorJetTreeMakerLegacyTruthOutput> m_trueOutputs;
+      vector<SCorrelatorJetTreeMakerFlatRecoOutput>    m_recoFlatOutputs;
+      vector<SCorrelatorJetTreeMakerFlatTruthOutput>   m_trueFlatOutputs;
+      vector<unique_ptr<SCorrelatorJetTreeMakerNTupleWriter<SCorrelatorJetTreeMakerRecoOutput>>>  m_recoNTuples;
+      vector<unique_ptr<SCorrelatorJetTreeMakerNTupleWriter<SCorrelatorJetTreeMakerTruthOutput>>> m_trueNTuples;
+      vector<unique_ptr<SCorrelatorJetTreeMakerParquetSink<SCorrelatorJetTreeMakerRecoOutput>>>   m_recoParquets;
+      vector<unique_ptr<SCorrelatorJetTreeMakerParquetSink<SCorrelatorJetTreeMakerTruthOutput>>>  m_trueParquets;
 
       // system members
-      vector<int>   m_vecEvtsToGrab;
-      map<int, int> m_mapCstToEmbedID;
+      long        m_nEvtProcessed = 0;
+      long        m_memWarmUp     = 0;
+      long        m_memLast       = 0;
+      vector<int> m_vecEvtsToGrab;
 
       // jet parameters
-      double               m_jetR         = 0.4;
-      uint32_t             m_jetType      = 0;
-      JetAlgorithm         m_jetAlgo      = antikt_algorithm;
-      JetDefinition*       m_trueJetDef   = NULL;
-      JetDefinition*       m_recoJetDef   = NULL;
-      ClusterSequence*     m_trueClust    = NULL;
-      ClusterSequence*     m_recoClust    = NULL;
-      RecombinationScheme  m_recombScheme = pt_scheme;
-
-      // event, jet members
-      long long         m_partonID[CONST::NPart];
-      CLHEP::Hep3Vector m_partonMom[CONST::NPart];
-      CLHEP::Hep3Vector m_trueVtx;
-      CLHEP::Hep3Vector m_recoVtx;
-      vector<PseudoJet> m_trueJets;
-      vector<PseudoJet> m_recoJets;
+      double              m_jetR         = 0.4;
+      uint32_t            m_jetType      = 0;
+      JetAlgorithm        m_jetAlgo      = antikt_algorithm;
+      RecombinationScheme m_recombScheme = pt_scheme;
+
+      // jet configurations and finders (persist for lifetime of job)
+      vector<SCorrelatorJetTreeMakerJetConfig> m_jetConfigs;
+      vector<SCorrelatorJetTreeMakerClusterer> m_trueClusterers;  // truth path only
+      vector<SCorrelatorJetTreeMakerClusterer> m_recoClusterers;  // reco path only
+
+      // for background estimation (kt configuration reused if
+      // index >= 0); reco path only
+      int                                  m_bkgdKtCfg = -1;
+      SCorrelatorJetTreeMakerBkgdEstimator m_bkgdEstimator;
+
+      // for truth-reco jet matching (reused for every configuration)
+      SCorrelatorJetTreeMakerJetMatcher m_jetMatcher;
+
+      // event, jet members: with parallel jet finding (see
+      // process_event), FindTrueJets and FindRecoJets each only
+      // write the members marked as theirs, and only read the rest
+      long long                            m_partonID[CONST::NPart];
+      CLHEP::Hep3Vector                    m_partonMom[CONST::NPart];
+      CLHEP::Hep3Vector                    m_trueVtx;
+      CLHEP::Hep3Vector                    m_recoVtx;
+      vector<PseudoJet>                    m_trueCsts;           // truth path only
+      vector<PseudoJet>                    m_recoCsts;           // reco path only
+      SCorrelatorJetTreeMakerCstProvenance m_trueProv;           // truth path only
+      SCorrelatorJetTreeMakerCstProvenance m_recoProv;           // reco path only
+      size_t                               m_nRecoTrkCsts = 0;  // reco path only
+
+      // batch-mode members
+      uint64_t                                                           m_nSubmitted = 0;
+      uint64_t                                                           m_nWritten   = 0;
+      mutex                                                              m_batchMutex;
+      condition_variable                                                 m_batchCond;
+      thread                                                             m_batchWriter;
+      vector<thread>                                                     m_batchWorkers;
+      vector<Monitor>                                                    m_batchMonitors;
+      SCorrelatorJetTreeMakerQueue<SCorrelatorJetTreeMakerEventSnapshot> m_snapshotQueue;
+      SCorrelatorJetTreeMakerQueue<SCorrelatorJetTreeMakerEventSnapshot> m_freeSnapshots;
+      SCorrelatorJetTreeMakerQueue<SCorrelatorJetTreeMakerEventRecord>   m_recordQueue;
+      SCorrelatorJetTreeMakerQueue<SCorrelatorJetTreeMakerEventRecord>   m_freeRecords;
+
+      // per-event track features and selection (reco path only)
+      SCorrelatorJetTreeMakerTrackTable    m_trkTable;
+      SCorrelatorJetTreeMakerTrackSelector m_trkSelector;
+
+      // per-event truth particle features and selection, plus
+      // charges cached by pdg code (truth path only)
+      SCorrelatorJetTreeMakerParticleTable    m_parTable;
+      SCorrelatorJetTreeMakerParticleSelector m_parSelector;
+      SCorrelatorJetTreeMakerChargeTable      m_chrgTable;
+
+      // calorimeter clusters of the store being added (reco path only)
+      SCorrelatorJetTreeMakerCaloTable m_caloTable;
+
+      // dead tpc sectors by run (if a table was provided)
+      SCorrelatorJetTreeMakerTpcDeadSectorTable m_tpcDeadSectors;
+
+      // track-cut variations: reco jets are found and written for
+      // each variation and jet configuration [iVar][iCfg], the
+      // track table and truth jets are shared with the nominal cuts
+      vector<SCorrelatorJetTreeMakerTrackCutVariation>        m_trkVariations;
+      vector<SCorrelatorJetTreeMakerTrackSelector>            m_varSelectors;
+      vector<vector<PseudoJet>>                               m_varRecoCsts;
+      vector<vector<SCorrelatorJetTreeMakerClusterer>>        m_varClusterers;
+      vector<vector<TTree*>>                                  m_varTrees;
+      vector<vector<SCorrelatorJetTreeMakerLegacyRecoOutput>> m_varOutputs;
+      vector<vector<SCorrelatorJetTreeMakerFlatRecoOutput>>   m_varFlatOutputs;
 
   };
 
@@ -249,63 +249,318 @@ namespace SColdQcdCorrelatorAnalysis {
 
   void SCorrelatorJetTreeMaker::SetJetAlgo(const ALGO jetAlgo) {
 
+    m_jetAlgo = GetFastJetAlgo(jetAlgo);
+    return;
+
+  }  // end 'SetJetAlgo(ALGO)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetRecombScheme(const RECOMB recombScheme) {
+
+    m_recombScheme = GetFastJetRecomb(recombScheme);
+    return;
+
+  }  // end 'setRecombScheme(RECOMB)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetJetParameters(const double rJet, uint32_t jetType, const ALGO jetAlgo, const RECOMB recombScheme) {
+
+    SetJetR(rJet);
+    SetJetType(jetType);
+    SetJetAlgo(jetAlgo);
+    SetRecombScheme(recombScheme);
+    return;
+
+  }  // end 'setJetParameters(double, unint32_t, ALGO, RECOMB)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetDoFlatOutput(const bool doFlat) {
+
+    // if true, constituents are written as flat columns
+    // indexed by a per-jet offset instead of nested vectors
+    m_doFlatOutput = doFlat;
+    return;
+
+  }  // end 'SetDoFlatOutput(bool)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetDoTiming(const bool doTiming, const string jsonName) {
+
+    // if a json file name is provided, the job summary
+    // is also dumped there at the end of the job
+    m_doTiming       = doTiming;
+    m_timingJsonName = jsonName;
+    return;
+
+  }  // end 'SetDoTiming(bool, string)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetDoParallelJetFinding(const bool doParallel) {
+
+    // if true, truth jet finding runs in a second thread
+    // alongside reco jet finding (MC only)
+    m_doParallelJets = doParallel;
+    return;
+
+  }  // end 'SetDoParallelJetFinding(bool)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetBatchMode(const size_t nThreads, const size_t queueSize) {
+
+    // if no. of threads is nonzero, clustering and output
+    // building are handed off to a pool of worker threads
+    m_nBatchThreads  = nThreads;
+    m_batchQueueSize = (queueSize > 0) ? queueSize : 1;
+    return;
+
+  }  // end 'SetBatchMode(size_t, size_t)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetDoAsyncWrite(const bool doAsync) {
+
+    // if true, output trees are filled by a background writer
+    // thread while the next event is being processed
+    m_doAsyncWrite = doAsync;
+    return;
+
+  }  // end 'SetDoAsyncWrite(bool)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetCompression(const SCorrelatorJetTreeMakerWriteConfig::COMP algo, const int level) {
+
+    m_writeConfig.compAlgo  = algo;
+    m_writeConfig.compLevel = level;
+    return;
+
+  }  // end 'SetCompression(SCorrelatorJetTreeMakerWriteConfig::COMP, int)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetBasketSize(const int size) {
+
+    m_writeConfig.basketSize = size;
+    return;
+
+  }  // end 'SetBasketSize(int)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetAutoFlush(const long long autoFlush) {
+
+    // > 0: flush (and start a new cluster) every N entries,
+    // < 0: flush every N bytes, 0: ROOT default
+    m_writeConfig.autoFlush = autoFlush;
+    return;
+
+  }  // end 'SetAutoFlush(long long)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetAutoSave(const long long autoSave) {
+
+    // same sign convention as SetAutoFlush(long long)
+    m_writeConfig.autoSave = autoSave;
+    return;
+
+  }  // end 'SetAutoSave(long long)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetDoFloatOutput(const bool doFloat) {
+
+    // if true, jet and constituent kinematics are
+    // written as floats rather than doubles
+    m_doFloatOutput = doFloat;
+    return;
+
+  }  // end 'SetDoFloatOutput(bool)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetOutputPrecision(const SCorrelatorJetTreeMakerPrecision& precision) {
+
+    // per-column mantissa bits, turns on float output
+    m_precision     = precision;
+    m_doFloatOutput = true;
+    return;
+
+  }  // end 'SetOutputPrecision(SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetOutputBackend(const BACKEND backend) {
+
+    // trees, rntuples (see SCorrelatorJetTreeMakerNTuple.h), or both
+    m_doTreeOutput   = ((backend == BACKEND::TREE)   || (backend == BACKEND::BOTH));
+    m_doNTupleOutput = ((backend == BACKEND::NTUPLE) || (backend == BACKEND::BOTH));
+    return;
+
+  }  // end 'SetOutputBackend(BACKEND)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetParquetOutput(const string baseName, const long long rowGroupSize) {
+
+    // written next to the trees/rntuples (see SCorrelatorJetTreeMakerParquet.h)
+    m_doParquetOutput     = true;
+    m_parquetBaseName     = baseName;
+    m_parquetRowGroupSize = rowGroupSize;
+    return;
+
+  }  // end 'SetParquetOutput(string, long long)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetJetArea(const SCorrelatorJetTreeMakerAreaConfig::TYPE type, const double ghostArea) {
+
+    // ghost grids are built once per jet configuration in InitJetFinders()
+    m_areaConfig.type      = type;
+    m_areaConfig.ghostArea = ghostArea;
+    return;
+
+  }  // end 'SetJetArea(SCorrelatorJetTreeMakerAreaConfig::TYPE, double)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetBkgdSubtraction(const SCorrelatorJetTreeMakerBkgdConfig::TYPE type, const bool doCstSub) {
+
+    // subtraction needs jet areas, which are turned on in InitBkgd() if needed
+    m_bkgdConfig.type     = type;
+    m_bkgdConfig.doCstSub = doCstSub;
+    return;
+
+  }  // end 'SetBkgdSubtraction(SCorrelatorJetTreeMakerBkgdConfig::TYPE, bool)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetJetMatching(const bool doMatch, const double maxDr) {
+
+    // matching only happens for simulation (see DoJetMatching())
+    m_matchConfig.doMatch = doMatch;
+    m_matchConfig.maxDr   = maxDr;
+    return;
+
+  }  // end 'SetJetMatching(bool, double)'
+
+
+
+  void SCorrelatorJetTreeMaker::AddTrackCutVariation(const string name, const SCorrelatorJetTreeMakerTrackCuts& cuts) {
+
+    // names go into tree names, so they have to be unique
+    for (const SCorrelatorJetTreeMakerTrackCutVariation& variation : m_trkVariations) {
+      if (variation.name == name) {
+        cerr << "SCorrelatorJetTreeMaker::AddTrackCutVariation: WARNING!\n"
+             << "  Variation '" << name << "' was already added! Ignoring."
+             << endl;
+        return;
+      }
+    }
+
+    SCorrelatorJetTreeMakerTrackCutVariation variation;
+    variation.name = name;
+    variation.cuts = cuts;
+    m_trkVariations.push_back(variation);
+    return;
+
+  }  // end 'AddTrackCutVariation(string, SCorrelatorJetTreeMakerTrackCuts&)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetTpcSectorMask(const float maskWidth, const vector<int> deadSectors) {
+
+    // only applied if masking sectors (see SetMaskTpcSectors(bool))
+    m_tpcSectorConfig.maskWidth   = maskWidth;
+    m_tpcSectorConfig.deadSectors = deadSectors;
+    return;
+
+  }  // end 'SetTpcSectorMask(float, vector<int>)'
+
+
+
+  void SCorrelatorJetTreeMaker::SetTpcDeadSectorTable(const string fileName) {
+
+    // dead sectors from the table replace any set by hand
+    m_tpcDeadSectorFile = fileName;
+    return;
+
+  }  // end 'SetTpcDeadSectorTable(string)'
+
+
+
+  void SCorrelatorJetTreeMaker::AddJetConfiguration(const double rJet, const ALGO jetAlgo, const RECOMB recombScheme) {
+
+    // each added configuration is clustered from the same
+    // constituents as the nominal one (see SetJetParameters)
+    // and written to its own, tagged trees
+    SCorrelatorJetTreeMakerJetConfig jetConfig;
+    jetConfig.rJet   = rJet;
+    jetConfig.algo   = GetFastJetAlgo(jetAlgo);
+    jetConfig.recomb = GetFastJetRecomb(recombScheme);
+    jetConfig.tag    = jetConfig.MakeTag();
+    m_jetConfigs.push_back(jetConfig);
+    return;
+
+  }  // end 'AddJetConfiguration(double, ALGO, RECOMB)'
+
+
+
+  JetAlgorithm SCorrelatorJetTreeMaker::GetFastJetAlgo(const ALGO jetAlgo) {
+
+    JetAlgorithm fjAlgo;
     switch (jetAlgo) {
       case ALGO::ANTIKT:
-        m_jetAlgo = fastjet::antikt_algorithm;
+        fjAlgo = fastjet::antikt_algorithm;
         break;
       case ALGO::KT:
-        m_jetAlgo = fastjet::kt_algorithm;
+        fjAlgo = fastjet::kt_algorithm;
         break;
       case ALGO::CAMBRIDGE:
-        m_jetAlgo = fastjet::cambridge_algorithm;
+        fjAlgo = fastjet::cambridge_algorithm;
         break;
       default:
-        m_jetAlgo = fastjet::antikt_algorithm;
+        fjAlgo = fastjet::antikt_algorithm;
         break;
     }
-    return;
+    return fjAlgo;
 
-  }  // end 'SetJetAlgo(ALGO)'
+  }  // end 'GetFastJetAlgo(ALGO)'
 
 
 
-  void SCorrelatorJetTreeMaker::SetRecombScheme(const RECOMB recombScheme) {
+  RecombinationScheme SCorrelatorJetTreeMaker::GetFastJetRecomb(const RECOMB recombScheme) {
 
+    RecombinationScheme fjRecomb;
     switch(recombScheme) {
       case RECOMB::E_SCHEME:
-        m_recombScheme = fastjet::E_scheme;
+        fjRecomb = fastjet::E_scheme;
         break;
       case RECOMB::PT_SCHEME:
-        m_recombScheme = fastjet::pt_scheme;
+        fjRecomb = fastjet::pt_scheme;
         break;
       case RECOMB::PT2_SCHEME:
-        m_recombScheme = fastjet::pt2_scheme;
+        fjRecomb = fastjet::pt2_scheme;
         break;
       case RECOMB::ET_SCHEME:
-        m_recombScheme = fastjet::Et_scheme;
+        fjRecomb = fastjet::Et_scheme;
         break;
       case RECOMB::ET2_SCHEME:
-        m_recombScheme = fastjet::Et2_scheme;
+        fjRecomb = fastjet::Et2_scheme;
         break;
       default:
-        m_recombScheme = fastjet::E_scheme;
+        fjRecomb = fastjet::E_scheme;
         break;
     }
-    return;
-
-  }  // end 'setRecombScheme(RECOMB)'
-
+    return fjRecomb;
 
-
-  void SCorrelatorJetTreeMaker::SetJetParameters(const double rJet, uint32_t jetType, const ALGO jetAlgo, const RECOMB recombScheme) {
-
-    SetJetR(rJet);
-    SetJetType(jetType);
-    SetJetAlgo(jetAlgo);
-    SetRecombScheme(recombScheme);
-    return;
-
-  }  // end 'setJetParameters(double, unint32_t, ALGO, RECOMB)'
+  }  // end 'GetFastJetRecomb(RECOMB)'
 
 }  // end SColdQcdCorrelatorAnalysis namespace
 
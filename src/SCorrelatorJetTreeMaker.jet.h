@@ -28,19 +28,25 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::FindTrueJets(PHCompositeNode*) Finding truth (inclusive) jets..." << endl;
     }
 
-    // define jets
-    m_trueJetDef = new JetDefinition(m_jetAlgo, m_jetR, m_recombScheme, fastjet::Best);
-
-    // declare constituent vector and jet map
-    vector<fastjet::PseudoJet>     particles;
-    map<int, pair<Jet::SRC, int>>  fjMapMC;
+    // truth timing/counters are kept separately (and merged
+    // at the end) so that this can run alongside FindRecoJets.
+    // the same goes for everything else written from here on:
+    // only truth members (see SCorrelatorJetTreeMaker.h) and the
+    // particle slots of the QA histograms (OBJECT::PART and
+    // CST_TYPE::PART_CST), which the reco path never fills
+    Monitor& monitor = m_doParallelJets ? m_trueMonitor : m_monitor;
 
     // add constituents
-    AddParticles(topNode, particles, fjMapMC);
-
-    // cluster jets
-    m_trueClust = new ClusterSequence(particles, *m_trueJetDef);
-    m_trueJets  = m_trueClust -> inclusive_jets();
+    CollectTrueCsts(topNode, monitor);
+
+    // cluster jets for each configuration using the same constituents
+    {
+      Monitor::Timer timer(monitor, Monitor::STAGE::TRUE_CLUST);
+      for (SCorrelatorJetTreeMakerClusterer& clusterer : m_trueClusterers) {
+        clusterer.Cluster(m_trueCsts);
+        monitor.Count(Monitor::COUNT::NTRUE_JET, clusterer.GetJets().size());
+      }
+    }
     return;
 
   }  // end 'FindTrueJets(PHCompositeNode*)'
@@ -54,95 +60,157 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::FindRecoJets(PHCompositeNode*) Finding jets..." << endl;
     }
 
-    // define jets
-    m_recoJetDef = new JetDefinition(m_jetAlgo, m_jetR, m_recombScheme, fastjet::Best);
-
-    // declare constituent vector and jet map
-    vector<fastjet::PseudoJet>    particles;
-    map<int, pair<Jet::SRC, int>> fjMap;
-
     // add constitutents
-    if (m_addTracks) AddTracks(topNode, particles, fjMap);
-    if (m_addFlow)   AddFlow(topNode,   particles, fjMap);
-    if (m_addECal)   AddECal(topNode,   particles, fjMap);
-    if (m_addHCal)   AddHCal(topNode,   particles, fjMap);
-
-    // cluster jets
-    m_recoClust = new ClusterSequence(particles, *m_recoJetDef);
-    m_recoJets  = m_recoClust -> inclusive_jets();
+    CollectRecoCsts(topNode);
+
+    // cluster jets for each configuration using the same constituents,
+    // then estimate background (reusing a kt configuration if possible)
+    {
+      Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_CLUST);
+      for (SCorrelatorJetTreeMakerClusterer& clusterer : m_recoClusterers) {
+        clusterer.Cluster(m_recoCsts);
+        m_monitor.Count(Monitor::COUNT::NRECO_JET, clusterer.GetJets().size());
+      }
+      if (DoBkgdSubtraction()) {
+        m_bkgdEstimator.Estimate(m_recoCsts, (m_bkgdKtCfg >= 0) ? &m_recoClusterers[m_bkgdKtCfg] : NULL);
+      }
+    }
+
+    // then reco jets for each track-cut variation
+    if (!m_trkVariations.empty()) {
+      FindVariationJets(topNode);
+    }
     return;
 
   }  // end 'FindRecoJets(PHCompositeNode*)'
 
 
 
-  void SCorrelatorJetTreeMaker::AddParticles(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap) {
+  void SCorrelatorJetTreeMaker::CollectTrueCsts(PHCompositeNode* topNode, Monitor& monitor) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::AddParticles(PHComposite*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&) Adding MC particles..." << endl;
+      cout << "SCorrelatorJetTreeMaker::CollectTrueCsts(PHCompositeNode*, Monitor&) Collecting truth constituents..." << endl;
     }
 
-    // loop over relevant subevents
-    unsigned int iCst    = particles.size();
-    unsigned int nParTot = 0;
-    unsigned int nParAcc = 0;
-    double       eParSum = 0.;
-    for (const int evtToGrab : m_vecEvtsToGrab) {
+    // add constituents
+    Monitor::Timer timer(monitor, Monitor::STAGE::TRUE_CSTS);
+    AddParticles(topNode, m_trueCsts, m_trueProv);
+    monitor.Count(Monitor::COUNT::NTRUE_CST, m_trueCsts.size());
+    return;
+
+  }  // end 'CollectTrueCsts(PHCompositeNode*, Monitor&)'
 
-      // grab subevent
-      HepMC::GenEvent* mcEvt = GetMcEvent(topNode, evtToGrab);
 
-      // grab embedding ID
-      const int embedID = GetEmbedID(topNode, evtToGrab);
 
-      // loop over particles in subevent
-      for (HepMC::GenEvent::particle_const_iterator itPar = mcEvt -> particles_begin(); itPar != mcEvt -> particles_end(); ++itPar) {
+  void SCorrelatorJetTreeMaker::CollectRecoCsts(PHCompositeNode* topNode) {
 
-        // check if particle is final state
-        const bool isFinalState = ((*itPar) -> status() == 1);
-        if (!isFinalState) {
-          continue;
-        } else {
-          ++nParTot;
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::CollectRecoCsts(PHCompositeNode*) Collecting reco constituents..." << endl;
+    }
+
+    // add constitutents
+    Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_CSTS);
+    if (m_addTracks) AddTracks(topNode, m_recoCsts, m_recoProv);
+    m_nRecoTrkCsts = m_recoCsts.size();
+    if (m_addFlow)   AddFlow(topNode,   m_recoCsts, m_recoProv);
+    if (m_addECal)   AddECal(topNode,   m_recoCsts, m_recoProv);
+    if (m_addHCal)   AddHCal(topNode,   m_recoCsts, m_recoProv);
+    m_monitor.Count(Monitor::COUNT::NRECO_CST, m_recoCsts.size());
+    return;
+
+  }  // end 'CollectRecoCsts(PHCompositeNode*)'
+
+
+
+  void SCorrelatorJetTreeMaker::FindVariationJets(PHCompositeNode* topNode) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FindVariationJets(PHCompositeNode*) Finding jets for track-cut variations..." << endl;
+    }
+
+    // the track table was already filled in AddTracks: only the
+    // selection is redone, and non-track constituents are shared
+    SvtxTrackMap* mapTrks = m_isMC ? GetTrackMap(topNode) : NULL;
+    for (size_t iVar = 0; iVar < m_trkVariations.size(); iVar++) {
+
+      vector<PseudoJet>& csts = m_varRecoCsts[iVar];
+      {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_CSTS);
+        m_varSelectors[iVar].Select(m_trkTable);
+
+        csts.clear();
+        for (size_t iTrk = 0; iTrk < m_trkTable.Size(); iTrk++) {
+          if (!m_varSelectors[iVar].IsAccepted(iTrk)) {
+            continue;
+          }
+
+          // barcodes are memoized, so tracks passing the nominal cuts aren't re-evaluated
+          if (m_isMC) {
+            m_trkTable.matchID[iTrk] = GetMatchID(mapTrks -> get(m_trkTable.trkID[iTrk]));
+          }
+
+          // variation tracks get their own provenance rows
+          fastjet::PseudoJet fjTrack(m_trkTable.px[iTrk], m_trkTable.py[iTrk], m_trkTable.pz[iTrk], m_trkTable.ene[iTrk]);
+          fjTrack.set_user_index(m_recoProv.Add(Jet::SRC::TRACK, m_trkTable.trkID[iTrk], 0, m_trkTable.matchID[iTrk]));
+          csts.push_back(fjTrack);
         }
+        csts.insert(csts.end(), m_recoCsts.begin() + m_nRecoTrkCsts, m_recoCsts.end());
+      }
 
-        // check if particle is good
-        const bool isGoodPar = IsGoodParticle(*itPar);
-        if (!isGoodPar) {
-          continue;
-        } else {
-          ++nParAcc;
+      {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_CLUST);
+        for (SCorrelatorJetTreeMakerClusterer& clusterer : m_varClusterers[iVar]) {
+          clusterer.Cluster(csts);
         }
+      }
+    }  // end variation loop
+    return;
+
+  }  // end 'FindVariationJets(PHCompositeNode*)'
+
 
-        // grab particle info
-        const double parPx = (*itPar) -> momentum().px();
-        const double parPy = (*itPar) -> momentum().py();
-        const double parPz = (*itPar) -> momentum().pz();
-        const double parE  = (*itPar) -> momentum().e();
-        const int    parID = (*itPar) -> barcode();
-
-        // map barcode onto relevant embeddingID
-        m_mapCstToEmbedID[parID] = embedID;
-
-        // create pseudojet & add to constituent vector
-        fastjet::PseudoJet fjParticle(parPx, parPy, parPz, parE);
-        fjParticle.set_user_index(parID);
-        particles.push_back(fjParticle);
-
-      
-        pair<int, pair<Jet::SRC, int>> jetPartPair(iCst, make_pair(Jet::SRC::PARTICLE, parID));
-        fjMap.insert(jetPartPair);
-
-        // fill QA histograms, increment sums and counters
-        m_hObjectQA[OBJECT::PART][INFO::PT]  -> Fill(fjParticle.perp());
-        m_hObjectQA[OBJECT::PART][INFO::ETA] -> Fill(fjParticle.pseudorapidity());
-        m_hObjectQA[OBJECT::PART][INFO::PHI] -> Fill(fjParticle.phi_std());
-        m_hObjectQA[OBJECT::PART][INFO::ENE] -> Fill(fjParticle.E());
-        eParSum += parE;
-        ++iCst;
-      }  // end particle loop
-    }  // end subevent loop
+
+  void SCorrelatorJetTreeMaker::AddParticles(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::AddParticles(PHComposite*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding MC particles..." << endl;
+    }
+
+    // extract particle features once for the event
+    // and evaluate cuts over the whole batch
+    FillParticleTable(topNode);
+    SelectParticles();
+
+    // loop over accepted particles
+    unsigned int nParTot = m_parTable.Size();
+    unsigned int nParAcc = 0;
+    double       eParSum = 0.;
+    for (size_t iPar = 0; iPar < m_parTable.Size(); iPar++) {
+      if (!m_parSelector.IsAccepted(iPar)) {
+        continue;
+      } else {
+        ++nParAcc;
+      }
+
+      // create pseudojet & add to constituent vector, recording
+      // barcode and embedding ID in the provenance table
+      const int parID = m_parTable.barcode[iPar];
+
+      fastjet::PseudoJet fjParticle(m_parTable.px[iPar], m_parTable.py[iPar], m_parTable.pz[iPar], m_parTable.ene[iPar]);
+      fjParticle.set_user_index(prov.Add(Jet::SRC::PARTICLE, parID, m_parTable.embedID[iPar], parID));
+      particles.push_back(fjParticle);
+
+      // fill QA histograms, increment sums and counters
+      m_hObjectQA[OBJECT::PART][INFO::PT]  -> Fill(m_parTable.pt[iPar]);
+      m_hObjectQA[OBJECT::PART][INFO::ETA] -> Fill(m_parTable.eta[iPar]);
+      m_hObjectQA[OBJECT::PART][INFO::PHI] -> Fill(fjParticle.phi_std());
+      m_hObjectQA[OBJECT::PART][INFO::ENE] -> Fill(m_parTable.ene[iPar]);
+      eParSum += m_parTable.ene[iPar];
+    }  // end particle loop
 
     // fill QA histograms
     m_hNumObject[OBJECT::PART]             -> Fill(nParAcc);
@@ -151,84 +219,78 @@ namespace SColdQcdCorrelatorAnalysis {
     m_hSumCstEne[CST_TYPE::PART_CST]       -> Fill(eParSum);
     return;
 
-  }  // end 'AddParticles(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&)'
+  }  // end 'AddParticles(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
 
 
 
-  void SCorrelatorJetTreeMaker::AddTracks(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap) {
+  void SCorrelatorJetTreeMaker::AddTracks(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::AddTracks(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&) Adding tracks..." << endl;
+      cout << "SCorrelatorJetTreeMaker::AddTracks(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding tracks..." << endl;
     }
 
+    // extract track features once for the event
+    // and evaluate cuts over the whole batch
+    FillTrackTable(topNode);
+    SelectTracks();
+
     // loop over tracks
-    unsigned int  iCst    = particles.size();
-    SvtxTrack*    track   = NULL;
+    unsigned int  nTrkTot = m_trkTable.Size();
+    unsigned int  nTrkAcc = 0;
+    double        eTrkSum = 0.;
     SvtxTrackMap* mapTrks = GetTrackMap(topNode);
-    for (SvtxTrackMap::Iter itTrk = mapTrks -> begin(); itTrk != mapTrks -> end(); ++itTrk) {
-
-      // get track
-      track = itTrk -> second;
-      if (!track) {
-        continue;
-      }
+    for (size_t iTrk = 0; iTrk < m_trkTable.Size(); iTrk++) {
 
       // check if good
-      const bool isGoodTrack = IsGoodTrack(track, topNode);
+      const bool isGoodTrack = m_trkSelector.IsAccepted(iTrk);
       if (!isGoodTrack) {
         continue;
+      } else {
+        ++nTrkAcc;
       }
 
-      // create pseudojet and add to constituent vector
-      const int    trkID = track -> get_id();
-      const double trkPx = track -> get_px();
-      const double trkPy = track -> get_py();
-      const double trkPz = track -> get_pz();
-      const double trkE  = sqrt((trkPx * trkPx) + (trkPy * trkPy) + (trkPz * trkPz) + (0.140 * 0.140));  // FIXME move pion mass to constant in utilities namespace
-
       // grab barcode of matching particle
-      int matchID;
       if (m_isMC) {
-        matchID = GetMatchID(track);
-      } else {
-        matchID = -1;
+        m_trkTable.matchID[iTrk] = GetMatchID(mapTrks -> get(m_trkTable.trkID[iTrk]));
       }
 
-      fastjet::PseudoJet fjTrack(trkPx, trkPy, trkPz, trkE);
-      fjTrack.set_user_index(matchID);
+      // create pseudojet and add to constituent vector
+      fastjet::PseudoJet fjTrack(m_trkTable.px[iTrk], m_trkTable.py[iTrk], m_trkTable.pz[iTrk], m_trkTable.ene[iTrk]);
+      fjTrack.set_user_index(prov.Add(Jet::SRC::TRACK, m_trkTable.trkID[iTrk], 0, m_trkTable.matchID[iTrk]));
       particles.push_back(fjTrack);
 
-      // add track to fastjet map
-      pair<int, pair<Jet::SRC, int>> jetTrkPair(iCst, make_pair(Jet::SRC::TRACK, trkID));
-      fjMap.insert(jetTrkPair);
-
-      // grab track dca and vertex
-      pair<double, double> trkDcaPair = GetTrackDcaPair(track, topNode);
-      CLHEP::Hep3Vector    trkVtx     = GetTrackVertex(track, topNode);
-
-      // grab remaining track info
-      const double trkQuality = track -> get_quality();
-      const double trkDeltaPt = GetTrackDeltaPt(track);
-      const double trkDcaXY   = trkDcaPair.first;
-      const double trkDcaZ    = trkDcaPair.second;
-      const int    trkNumTpc  = GetNumLayer(track, SUBSYS::TPC);
-      const int    trkNumIntt = GetNumLayer(track, SUBSYS::INTT);
-      const int    trkNumMvtx = GetNumLayer(track, SUBSYS::MVTX);
-      ++iCst;
-
+      // fill QA histograms, increment sums and counters
+      m_hObjectQA[OBJECT::TRACK][INFO::PT]      -> Fill(m_trkTable.pt[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::ETA]     -> Fill(m_trkTable.eta[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::PHI]     -> Fill(m_trkTable.phi[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::ENE]     -> Fill(m_trkTable.ene[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::QUAL]    -> Fill(m_trkTable.quality[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::DCAXY]   -> Fill(m_trkTable.dcaXY[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::DCAZ]    -> Fill(m_trkTable.dcaZ[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::DELTAPT] -> Fill(m_trkTable.deltaPt[iTrk]);
+      m_hObjectQA[OBJECT::TRACK][INFO::NTPC]    -> Fill(m_trkTable.nTpc[iTrk]);
+      eTrkSum += m_trkTable.ene[iTrk];
     }  // end track loop
+
+    // fill QA histograms and update counters
+    m_monitor.Count(Monitor::COUNT::NTRK_SEEN,   nTrkTot);
+    m_monitor.Count(Monitor::COUNT::NTRK_ACCEPT, nTrkAcc);
+    m_hNumObject[OBJECT::TRACK]             -> Fill(nTrkAcc);
+    m_hNumCstAccept[CST_TYPE::TRACK_CST][0] -> Fill(nTrkTot);
+    m_hNumCstAccept[CST_TYPE::TRACK_CST][1] -> Fill(nTrkAcc);
+    m_hSumCstEne[CST_TYPE::TRACK_CST]       -> Fill(eTrkSum);
     return;
 
-  }  // end 'AddTracks(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&)'
+  }  // end 'AddTracks(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
 
 
 
-  void SCorrelatorJetTreeMaker::AddFlow(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap) {
+  void SCorrelatorJetTreeMaker::AddFlow(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::AddFlow(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&) Adding particle flow elements..." << endl;
+      cout << "SCorrelatorJetTreeMaker::AddFlow(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding particle flow elements..." << endl;
     }
 
     // warn if jets should be charged
@@ -237,7 +299,6 @@ namespace SColdQcdCorrelatorAnalysis {
     }
 
     // loop over pf elements
-    unsigned int                                iCst      = particles.size();
     unsigned int                                nFlowTot  = 0;
     unsigned int                                nFlowAcc  = 0;
     double                                      eFlowSum  = 0.;
@@ -270,20 +331,15 @@ namespace SColdQcdCorrelatorAnalysis {
       const double pfPz = flow -> get_pz();
 
       fastjet::PseudoJet fjFlow(pfPx, pfPy, pfPz, pfE);
-      fjFlow.set_user_index(iCst);
+      fjFlow.set_user_index(prov.Add(Jet::SRC::PARTICLE, pfID, 0, -1));
       particles.push_back(fjFlow);
 
-      // add pf element to fastjet map
-      pair<int, pair<Jet::SRC, int>> jetPartFlowPair(iCst, make_pair(Jet::SRC::PARTICLE, pfID));
-      fjMap.insert(jetPartFlowPair);
-
       // fill QA histograms, increment sums and counters
       m_hObjectQA[OBJECT::FLOW][INFO::PT]  -> Fill(fjFlow.perp());
       m_hObjectQA[OBJECT::FLOW][INFO::ETA] -> Fill(fjFlow.pseudorapidity());
       m_hObjectQA[OBJECT::FLOW][INFO::PHI] -> Fill(fjFlow.phi_std());
       m_hObjectQA[OBJECT::FLOW][INFO::ENE] -> Fill(fjFlow.E());
       eFlowSum += pfE;
-      ++iCst;
     }  // end pf element loop
 
     // fill QA histograms
@@ -293,15 +349,15 @@ namespace SColdQcdCorrelatorAnalysis {
     m_hSumCstEne[CST_TYPE::FLOW_CST]       -> Fill(eFlowSum);
     return;
 
-  }  // end 'AddFlow(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&)'
+  }  // end 'AddFlow(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
 
 
 
-  void SCorrelatorJetTreeMaker::AddECal(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap) {
+  void SCorrelatorJetTreeMaker::AddECal(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::AddECal(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&) Adding ECal clusters..." << endl;
+      cout << "SCorrelatorJetTreeMaker::AddECal(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding ECal clusters..." << endl;
     }
 
     // warn if jets should be charged
@@ -309,89 +365,34 @@ namespace SColdQcdCorrelatorAnalysis {
       cerr << "SCorrelatorJetTreeMaker::AddECal - Warning - trying to add calorimeter clusters to charged jets!" << endl;
     }
 
-    // grab vertex and clusters
-    GlobalVertex*        vtx          = GetGlobalVertex(topNode);
-    RawClusterContainer* emClustStore = GetClusterStore(topNode, "CLUSTER_CEMC");
-
-    // add emcal clusters if needed
-    unsigned int iCst      = particles.size();
-    unsigned int nClustTot = 0;
-    unsigned int nClustAcc = 0;
-    unsigned int nClustEM  = 0;
-    double       eClustSum = 0.;
-
-    // loop over em clusters
-    RawClusterContainer::ConstRange    emClustRange = emClustStore -> getClusters();
-    RawClusterContainer::ConstIterator itEMClust;
-    for (itEMClust = emClustRange.first; itEMClust != emClustRange.second; ++itEMClust) {
-
-      // grab cluster
-      const RawCluster* emClust = itEMClust -> second;
-      if (!emClust) {
-        continue;
-      } else {
-        ++nClustTot;
-      }
-
-      // construct vertex and get 4-momentum
-      const double vX = vtx -> get_x();
-      const double vY = vtx -> get_y();
-      const double vZ = vtx -> get_z();
-
-      CLHEP::Hep3Vector hepVecVtx     = CLHEP::Hep3Vector(vX, vY, vZ);
-      CLHEP::Hep3Vector hepVecEMClust = RawClusterUtility::GetECoreVec(*emClust, hepVecVtx);
-
-      // check if good
-      const bool isGoodECal = IsGoodECal(hepVecEMClust);
-      if (!isGoodECal) {
-        continue;
-      } else {
-        ++nClustAcc;
-      }
-
-      // create pseudojet and add to constituent vector
-      const int    emClustID  = emClust -> get_id();
-      const double emClustE   = hepVecEMClust.mag();
-      const double emClustPt  = hepVecEMClust.perp();
-      const double emClustPhi = hepVecEMClust.getPhi();
-      const double emClustPx  = emClustPt * cos(emClustPhi);
-      const double emClustPy  = emClustPt * sin(emClustPhi);
-      const double emClustPz  = sqrt((emClustE * emClustE) - (emClustPx * emClustPx) - (emClustPy * emClustPy));
- 
-      fastjet::PseudoJet fjCluster(emClustPx, emClustPy, emClustPz, emClustE);
-      fjCluster.set_user_index(iCst);
-      particles.push_back(fjCluster);
+    // grab vertex (once) and clusters
+    GlobalVertex*           vtx          = GetGlobalVertex(topNode);
+    RawClusterContainer*    emClustStore = GetClusterStore(topNode, "CLUSTER_CEMC");
+    const CLHEP::Hep3Vector hepVecVtx(vtx -> get_x(), vtx -> get_y(), vtx -> get_z());
 
-      // add em cluster to fastjet map
-      pair<int, pair<Jet::SRC, int>> jetEMClustPair(iCst, make_pair(Jet::SRC::CEMC_CLUSTER, emClustID));
-      fjMap.insert(jetEMClustPair);
+    // extract, select, and add em clusters
+    FillCaloTable(emClustStore, hepVecVtx, make_pair(m_ecalPtRange[0], m_ecalPtRange[1]), make_pair(m_ecalEtaRange[0], m_ecalEtaRange[1]));
 
-      // fill QA histograms, increment sums and counters
-      m_hObjectQA[OBJECT::ECLUST][INFO::PT]  -> Fill(fjCluster.perp());
-      m_hObjectQA[OBJECT::ECLUST][INFO::ETA] -> Fill(fjCluster.pseudorapidity());
-      m_hObjectQA[OBJECT::ECLUST][INFO::PHI] -> Fill(fjCluster.phi_std());
-      m_hObjectQA[OBJECT::ECLUST][INFO::ENE] -> Fill(fjCluster.E());
-      eClustSum += emClustE;
-      ++nClustEM;
-      ++iCst;
-    }  // end em cluster loop
+    const unsigned int nClustTot = m_caloTable.Size();
+    const unsigned int nClustAcc = m_caloTable.nAccept;
+    const double       eClustSum = AddCaloClusters(Jet::SRC::CEMC_CLUSTER, OBJECT::ECLUST, particles, prov);
 
     // fill QA histograms
-    m_hNumObject[OBJECT::ECLUST]           -> Fill(nClustEM);
+    m_hNumObject[OBJECT::ECLUST]           -> Fill(nClustAcc);
     m_hNumCstAccept[CST_TYPE::ECAL_CST][0] -> Fill(nClustTot);
     m_hNumCstAccept[CST_TYPE::ECAL_CST][1] -> Fill(nClustAcc);
     m_hSumCstEne[CST_TYPE::ECAL_CST]       -> Fill(eClustSum);
     return;
 
-  }  // end 'AddECal(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&)'
+  }  // end 'AddECal(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
 
 
 
-  void SCorrelatorJetTreeMaker::AddHCal(PHCompositeNode* topNode, vector<PseudoJet>& particles, map<int, pair<Jet::SRC, int>>& fjMap) {
+  void SCorrelatorJetTreeMaker::AddHCal(PHCompositeNode* topNode, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::AddHCal(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&) Adding HCal clusters..." << endl;
+      cout << "SCorrelatorJetTreeMaker::AddHCal(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding HCal clusters..." << endl;
     }
 
     // warn if jets should be charged
@@ -399,138 +400,179 @@ namespace SColdQcdCorrelatorAnalysis {
       cerr << "SCorrelatorJetTreeMaker::AddHCal - Warning - trying to add calorimeter clusters to charged jets!" << endl;
     }
 
-    // grab vertex and clusters
-    GlobalVertex*        vtx          = GetGlobalVertex(topNode);
-    RawClusterContainer* ihClustStore = GetClusterStore(topNode, "CLUSTER_HCALIN");
-    RawClusterContainer* ohClustStore = GetClusterStore(topNode, "CLUSTER_HCALOUT");
- 
-    // add emcal clusters if needed
-    unsigned int iCst      = particles.size();
+    // grab vertex (once)
+    GlobalVertex*           vtx = GetGlobalVertex(topNode);
+    const CLHEP::Hep3Vector hepVecVtx(vtx -> get_x(), vtx -> get_y(), vtx -> get_z());
+
+    // inner and outer hcal clusters go through the same steps
+    const array<pair<string, Jet::SRC>, 2> hcalStores = {
+      make_pair("CLUSTER_HCALIN",  Jet::SRC::HCALIN_CLUSTER),
+      make_pair("CLUSTER_HCALOUT", Jet::SRC::HCALOUT_CLUSTER)
+    };
+
     unsigned int nClustTot = 0;
     unsigned int nClustAcc = 0;
-    unsigned int nClustH   = 0;
     double       eClustSum = 0.;
+    for (const pair<string, Jet::SRC>& hcalStore : hcalStores) {
+      RawClusterContainer* hClustStore = GetClusterStore(topNode, hcalStore.first);
+      FillCaloTable(hClustStore, hepVecVtx, make_pair(m_hcalPtRange[0], m_hcalPtRange[1]), make_pair(m_hcalEtaRange[0], m_hcalEtaRange[1]));
 
-    // Loop over ih clusters
-    RawClusterContainer::ConstRange    ihClustRange = ihClustStore -> getClusters();
-    RawClusterContainer::ConstIterator itIHClust;
-    for (itIHClust = ihClustRange.first; itIHClust != ihClustRange.second; ++itIHClust) {
+      nClustTot += m_caloTable.Size();
+      nClustAcc += m_caloTable.nAccept;
+      eClustSum += AddCaloClusters(hcalStore.second, OBJECT::HCLUST, particles, prov);
+    }
 
-      // get ih cluster
-      const RawCluster* ihClust = itIHClust -> second;
-      if (!ihClust) {
-        continue;
-      } else {
-        ++nClustTot;
-      }
+    // fill QA histograms
+    m_hNumObject[OBJECT::HCLUST]           -> Fill(nClustAcc);
+    m_hSumCstEne[CST_TYPE::HCAL_CST]       -> Fill(eClustSum);
+    m_hNumCstAccept[CST_TYPE::HCAL_CST][0] -> Fill(nClustTot);
+    m_hNumCstAccept[CST_TYPE::HCAL_CST][1] -> Fill(nClustAcc);
+    return;
 
-      // construct vertex and get 4-momentum
-      const double vX = vtx -> get_x();
-      const double vY = vtx -> get_y();
-      const double vZ = vtx -> get_z();
+  }  // end 'AddHCal(PHCompositeNode*, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
 
-      CLHEP::Hep3Vector hepVecVtx     = CLHEP::Hep3Vector(vX, vY, vZ);
-      CLHEP::Hep3Vector hepVecIHClust = RawClusterUtility::GetECoreVec(*ihClust, hepVecVtx);
 
-      // check if good
-      const bool isGoodHCal = IsGoodHCal(hepVecIHClust);
-      if (!isGoodHCal) {
-        continue;
-      } else {
-        ++nClustAcc;
-      }
 
-      // create pseudojet and add to constituent vector
-      const int    ihClustID  = ihClust -> get_id();
-      const double ihClustE   = hepVecIHClust.mag();
-      const double ihClustPt  = hepVecIHClust.perp();
-      const double ihClustPhi = hepVecIHClust.getPhi();
-      const double ihClustPx  = ihClustPt * cos(ihClustPhi);
-      const double ihClustPy  = ihClustPt * sin(ihClustPhi);
-      const double ihClustPz  = sqrt((ihClustE * ihClustE) - (ihClustPx * ihClustPx) - (ihClustPy * ihClustPy));
-
-      fastjet::PseudoJet fjCluster(ihClustPx, ihClustPy, ihClustPz, ihClustE);
-      fjCluster.set_user_index(iCst);
-      particles.push_back(fjCluster);
+  void SCorrelatorJetTreeMaker::FillCaloTable(RawClusterContainer* clustStore, const CLHEP::Hep3Vector& hepVecVtx, const pair<double, double> ptRange, const pair<double, double> etaRange) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillCaloTable(RawClusterContainer*, CLHEP::Hep3Vector&, pair<double, double>, pair<double, double>) Extracting calorimeter clusters..." << endl;
+    }
 
-      // add ih cluster to fastjet map
-      pair<int, pair<Jet::SRC, int>> jetIHClustPair(iCst, make_pair(Jet::SRC::HCALIN_CLUSTER, ihClustID));
-      fjMap.insert(jetIHClustPair);
+    // clear table from previous store
+    m_caloTable.Reset();
+    m_caloTable.Reserve(clustStore -> size());
 
-      // fill QA histograms, increment sums and counters
-      m_hObjectQA[OBJECT::HCLUST][INFO::PT]  -> Fill(fjCluster.perp());
-      m_hObjectQA[OBJECT::HCLUST][INFO::ETA] -> Fill(fjCluster.pseudorapidity());
-      m_hObjectQA[OBJECT::HCLUST][INFO::PHI] -> Fill(fjCluster.phi_std());
-      m_hObjectQA[OBJECT::HCLUST][INFO::ENE] -> Fill(fjCluster.E());
-      eClustSum += ihClustE;
-      ++nClustH;
-      ++iCst;
-    }  // end ih cluster loop
-
-    // loop over oh clusters
-    RawClusterContainer::ConstRange    ohClustRange = ohClustStore -> getClusters();
-    RawClusterContainer::ConstIterator itOHClust;
-    for (itOHClust = ohClustRange.first; itOHClust != ohClustRange.second; ++itOHClust) {
-
-      // get oh cluster
-      const RawCluster* ohClust = itOHClust -> second;
-      if (!ohClust) {
+    // pull energy and position out of each cluster
+    RawClusterContainer::ConstRange    clustRange = clustStore -> getClusters();
+    RawClusterContainer::ConstIterator itClust;
+    for (itClust = clustRange.first; itClust != clustRange.second; ++itClust) {
+      const RawCluster* clust = itClust -> second;
+      if (!clust) {
         continue;
-      } else {
-        ++nClustTot;
       }
+      m_caloTable.AddRow(clust -> get_id(), clust -> get_ecore(), clust -> get_r(), clust -> get_phi(), clust -> get_z());
+    }
+
+    // then correct for the vertex and apply cuts in one pass each
+    m_caloTable.ComputeMomenta(hepVecVtx.x(), hepVecVtx.y(), hepVecVtx.z());
+    m_caloTable.Select(ptRange, etaRange);
+    return;
 
-      // construct vertex and get 4-momentum
-      const double vX = vtx -> get_x();
-      const double vY = vtx -> get_y();
-      const double vZ = vtx -> get_z();
+  }  // end 'FillCaloTable(RawClusterContainer*, CLHEP::Hep3Vector&, pair<double, double>, pair<double, double>)'
 
-      CLHEP::Hep3Vector hepVecVtx     = CLHEP::Hep3Vector(vX, vY, vZ);
-      CLHEP::Hep3Vector hepVecOHClust = RawClusterUtility::GetECoreVec(*ohClust, hepVecVtx);
 
-      // check if good
-      const bool isGoodHCal = IsGoodHCal(hepVecOHClust);
-      if (!isGoodHCal) {
+
+  double SCorrelatorJetTreeMaker::AddCaloClusters(const Jet::SRC source, const OBJECT object, vector<PseudoJet>& particles, SCorrelatorJetTreeMakerCstProvenance& prov) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::AddCaloClusters(Jet::SRC, OBJECT, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&) Adding calorimeter clusters..." << endl;
+    }
+
+    // loop over accepted clusters
+    double eClustSum = 0.;
+    for (size_t iClust = 0; iClust < m_caloTable.Size(); iClust++) {
+      if (!m_caloTable.isGood[iClust]) {
         continue;
-      } else {
-        ++nClustAcc;
       }
 
       // create pseudojet and add to constituent vector
-      const int    ohClustID  = ohClust -> get_id();
-      const double ohClustE   = hepVecOHClust.mag();
-      const double ohClustPt  = hepVecOHClust.perp();
-      const double ohClustPhi = hepVecOHClust.getPhi();
-      const double ohClustPx  = ohClustPt * cos(ohClustPhi);
-      const double ohClustPy  = ohClustPt * sin(ohClustPhi);
-      const double ohClustPz  = sqrt((ohClustE * ohClustE) - (ohClustPx * ohClustPx) - (ohClustPy * ohClustPy));
-
-      fastjet::PseudoJet fjCluster(ohClustPx, ohClustPy, ohClustPz, ohClustE);
-      fjCluster.set_user_index(iCst);
+      fastjet::PseudoJet fjCluster(m_caloTable.px[iClust], m_caloTable.py[iClust], m_caloTable.pz[iClust], m_caloTable.ene[iClust]);
+      fjCluster.set_user_index(prov.Add(source, m_caloTable.clustID[iClust], 0, -1));
       particles.push_back(fjCluster);
 
-      // add oh cluster to fastjet map
-      pair<int, pair<Jet::SRC, int>> jetOHClustPair(iCst, make_pair(Jet::SRC::HCALOUT_CLUSTER, ohClustID));
-      fjMap.insert(jetOHClustPair);
-
       // fill QA histograms, increment sums and counters
-      m_hObjectQA[OBJECT::HCLUST][INFO::PT]  -> Fill(fjCluster.perp());
-      m_hObjectQA[OBJECT::HCLUST][INFO::ETA] -> Fill(fjCluster.pseudorapidity());
-      m_hObjectQA[OBJECT::HCLUST][INFO::PHI] -> Fill(fjCluster.phi_std());
-      m_hObjectQA[OBJECT::HCLUST][INFO::ENE] -> Fill(fjCluster.E());
-      eClustSum += ohClustE;
-      ++nClustH;
-      ++iCst;
-    }  // end oh cluster loop
+      m_hObjectQA[object][INFO::PT]  -> Fill(m_caloTable.pt[iClust]);
+      m_hObjectQA[object][INFO::ETA] -> Fill(m_caloTable.eta[iClust]);
+      m_hObjectQA[object][INFO::PHI] -> Fill(fjCluster.phi_std());
+      m_hObjectQA[object][INFO::ENE] -> Fill(m_caloTable.ene[iClust]);
+      eClustSum += m_caloTable.ene[iClust];
+    }
+    return eClustSum;
 
-    // fill QA histograms
-    m_hNumObject[OBJECT::HCLUST]           -> Fill(nClustH);
-    m_hSumCstEne[CST_TYPE::HCAL_CST]       -> Fill(eClustSum);
-    m_hNumCstAccept[CST_TYPE::HCAL_CST][0] -> Fill(nClustTot);
-    m_hNumCstAccept[CST_TYPE::HCAL_CST][1] -> Fill(nClustAcc);
+  }  // end 'AddCaloClusters(Jet::SRC, OBJECT, vector<PseudoJet>&, SCorrelatorJetTreeMakerCstProvenance&)'
+
+
+
+  bool SCorrelatorJetTreeMaker::DoBkgdSubtraction() const {
+
+    return (m_bkgdConfig.type != SCorrelatorJetTreeMakerBkgdConfig::TYPE::NONE);
+
+  }  // end 'DoBkgdSubtraction()'
+
+
+
+  void SCorrelatorJetTreeMaker::InitBkgd() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::InitBkgd() Initializing background estimation..." << endl;
+    }
+
+    // subtraction needs jet areas, and constituent subtraction needs explicit ghosts
+    if (m_areaConfig.type == SCorrelatorJetTreeMakerAreaConfig::TYPE::NONE) {
+      cout << "SCorrelatorJetTreeMaker::InitBkgd() WARNING: background subtraction needs jet areas, turning on active areas." << endl;
+      m_areaConfig.type = SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE;
+    }
+    if (m_bkgdConfig.doCstSub && (m_areaConfig.type != SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE)) {
+      cout << "SCorrelatorJetTreeMaker::InitBkgd() WARNING: constituent subtraction needs active areas, turning it off." << endl;
+      m_bkgdConfig.doCstSub = false;
+    }
+    m_bkgdConfig.maxRap = GetMaxCstEta();
+
+    // reuse a kt configuration of the right radius for the median if there is one
+    m_bkgdKtCfg = -1;
+    for (size_t iCfg = 0; iCfg < m_jetConfigs.size(); iCfg++) {
+      const bool isKt      = (m_jetConfigs[iCfg].algo == kt_algorithm);
+      const bool isSameRad = (abs(m_jetConfigs[iCfg].rJet - m_bkgdConfig.rKt) < numeric_limits<float>::epsilon());
+      if (isKt && isSameRad) {
+        m_bkgdKtCfg = iCfg;
+        break;
+      }
+    }
+
+    SCorrelatorJetTreeMakerJetConfig ktConfig;
+    ktConfig.rJet = m_bkgdConfig.rKt;
+    m_bkgdEstimator.SetConfig(m_bkgdConfig, GetAreaConfig(ktConfig));
     return;
 
-  }  // end 'AddHCal(PHCompositeNode*, vector<PseudoJet>&, map<int, pair<Jet::SRC, int>>&)'
+  }  // end 'InitBkgd()'
+
+
+
+  double SCorrelatorJetTreeMaker::GetMaxCstEta() const {
+
+    // widest acceptance over all constituent types
+    double maxEta = 0.;
+    for (const double* etaRange : {m_parEtaRange, m_trkEtaRange, m_flowEtaRange, m_ecalEtaRange, m_hcalEtaRange}) {
+      maxEta = max(maxEta, max(abs(etaRange[0]), abs(etaRange[1])));
+    }
+    return maxEta;
+
+  }  // end 'GetMaxCstEta()'
+
+
+
+  bool SCorrelatorJetTreeMaker::DoJetMatching() const {
+
+    return (m_matchConfig.doMatch && m_isMC);
+
+  }  // end 'DoJetMatching()'
+
+
+
+  SCorrelatorJetTreeMakerAreaConfig SCorrelatorJetTreeMaker::GetAreaConfig(const SCorrelatorJetTreeMakerJetConfig& jetConfig) {
+
+    // if not set, ghosts cover the widest constituent acceptance plus a jet radius
+    SCorrelatorJetTreeMakerAreaConfig config = m_areaConfig;
+    if (config.ghostMaxRap <= 0.) {
+      config.ghostMaxRap = GetMaxCstEta() + jetConfig.rJet;
+    }
+    return config;
+
+  }  // end 'GetAreaConfig(SCorrelatorJetTreeMakerJetConfig&)'
 
 }  // end SColdQcdCorrelatorAnalysis namespace
 
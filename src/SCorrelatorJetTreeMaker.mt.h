@@ -0,0 +1,491 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMaker.mt.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+using namespace std;
+using namespace fastjet;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // batch-mode methods -------------------------------------------------------
+
+  void SCorrelatorJetTreeMaker::StartBatch() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::StartBatch() Starting " << m_nBatchThreads << " workers and output writer..." << endl;
+    }
+
+    // with no workers, only the writer is started (async writing)
+
+    // workers and writer each get their own timing/counters
+    m_batchMonitors.assign(m_nBatchThreads + 1, Monitor());
+    for (Monitor& monitor : m_batchMonitors) {
+      monitor.SetEnabled(m_doTiming);
+    }
+
+    // size queues: no more than twice the queue size
+    // of events are allowed to be in flight at once
+    m_nSubmitted = 0;
+    m_nWritten   = 0;
+    m_snapshotQueue.SetCapacity(m_batchQueueSize);
+    m_recordQueue.SetCapacity(m_batchQueueSize);
+    m_snapshotQueue.Open();
+    m_recordQueue.Open();
+
+    // processed snapshots are handed back to the event loop so that
+    // their buffers can be reused: at most one per event in flight
+    m_freeSnapshots.SetCapacity(2 * m_batchQueueSize);
+    m_freeSnapshots.Open();
+
+    // for async writing, records are recycled between the event
+    // loop and the writer: one is filled while the other is written
+    if (IsAsyncWrite()) {
+      m_recordQueue.SetCapacity(1);
+      m_freeRecords.SetCapacity(CONST::NWriteBuffers);
+      m_freeRecords.Open();
+      for (size_t iBuffer = 0; iBuffer < CONST::NWriteBuffers; iBuffer++) {
+        m_freeRecords.Push(SCorrelatorJetTreeMakerEventRecord());
+      }
+    }
+
+    // launch threads. the output file (and its trees and histograms)
+    // is still created on the main thread in Init and written/closed
+    // there in End: it's handed over to the writer when the writer is
+    // started and handed back when it's joined in StopBatch, so only
+    // one thread uses it at a time. this is on purpose (rather than
+    // opening and closing the file on the writer): the serial and
+    // batch paths share the same file/tree/histogram setup, and ROOT's
+    // current directory is per thread, so objects made in Init would
+    // otherwise not end up in a file owned by the writer
+    ROOT::EnableThreadSafety();
+    for (size_t iThread = 0; iThread < m_nBatchThreads; iThread++) {
+      m_batchWorkers.emplace_back(&SCorrelatorJetTreeMaker::RunBatchWorker, this, iThread);
+    }
+    m_batchWriter = thread(&SCorrelatorJetTreeMaker::RunBatchWriter, this);
+    return;
+
+  }  // end 'StartBatch()'
+
+
+
+  void SCorrelatorJetTreeMaker::SubmitSnapshot() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::SubmitSnapshot() Submitting event #" << m_nSubmitted << " to workers..." << endl;
+    }
+
+    // reuse the buffers of an already processed snapshot if there
+    // is one, then swap constituents into it: the event loop keeps
+    // the recycled buffers (and their capacity) for the next event
+    SCorrelatorJetTreeMakerEventSnapshot snapshot;
+    m_freeSnapshots.TryPop(snapshot);
+    snapshot.index = m_nSubmitted;
+    snapshot.info  = GetEventInfo();
+    snapshot.recoCsts.swap(m_recoCsts);
+    snapshot.trueCsts.swap(m_trueCsts);
+    snapshot.recoProv.source.swap(m_recoProv.source);
+    snapshot.recoProv.sourceID.swap(m_recoProv.sourceID);
+    snapshot.recoProv.embedID.swap(m_recoProv.embedID);
+    snapshot.recoProv.matchID.swap(m_recoProv.matchID);
+    snapshot.trueProv.source.swap(m_trueProv.source);
+    snapshot.trueProv.sourceID.swap(m_trueProv.sourceID);
+    snapshot.trueProv.embedID.swap(m_trueProv.embedID);
+    snapshot.trueProv.matchID.swap(m_trueProv.matchID);
+    snapshot.info.recoProv = NULL;
+    snapshot.info.trueProv = NULL;
+    m_recoCsts.clear();
+    m_trueCsts.clear();
+    m_recoProv.Reset();
+    m_trueProv.Reset();
+
+    // backpressure: wait until writer has caught up enough
+    {
+      const uint64_t     nMaxInFlight = 2 * m_batchQueueSize;
+      unique_lock<mutex> lock(m_batchMutex);
+      m_batchCond.wait(lock, [this, nMaxInFlight] {return (m_nSubmitted - m_nWritten) < nMaxInFlight;});
+    }
+    m_snapshotQueue.Push(move(snapshot));
+    ++m_nSubmitted;
+    return;
+
+  }  // end 'SubmitSnapshot()'
+
+
+
+  void SCorrelatorJetTreeMaker::SubmitRecord() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::SubmitRecord() Submitting event #" << m_nSubmitted << " to writer..." << endl;
+    }
+
+    // grab a free buffer: blocks while the writer is still busy with
+    // both, which keeps at most one event ahead of the writer
+    SCorrelatorJetTreeMakerEventRecord record;
+    m_freeRecords.Pop(record);
+
+    // build outputs into the free buffer; QA histograms are filled by the writer
+    const size_t                           nJetConfigs = m_jetConfigs.size();
+    const SCorrelatorJetTreeMakerEventInfo info        = GetEventInfo();
+    record.index = m_nSubmitted;
+    if (m_doFlatOutput) {
+      record.recoFlatOutputs.resize(nJetConfigs);
+      record.trueFlatOutputs.resize(m_isMC ? nJetConfigs : 0);
+    } else {
+      record.recoOutputs.resize(nJetConfigs);
+      record.trueOutputs.resize(m_isMC ? nJetConfigs : 0);
+    }
+
+    const SCorrelatorJetTreeMakerBkgdEstimator* bkgd = DoBkgdSubtraction() ? &m_bkgdEstimator : NULL;
+    for (size_t iCfg = 0; iCfg < nJetConfigs; iCfg++) {
+      {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_FILL);
+        if (m_doFlatOutput) {
+          FillRecoOutput(m_recoClusterers[iCfg].GetJets(), info, bkgd, record.recoFlatOutputs[iCfg], false);
+        } else {
+          FillRecoOutput(m_recoClusterers[iCfg].GetJets(), info, bkgd, record.recoOutputs[iCfg], false);
+        }
+      }
+      if (!m_isMC) {
+        continue;
+      }
+
+      {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::TRUE_FILL);
+        if (m_doFlatOutput) {
+          FillTrueOutput(m_trueClusterers[iCfg].GetJets(), info, record.trueFlatOutputs[iCfg], false);
+        } else {
+          FillTrueOutput(m_trueClusterers[iCfg].GetJets(), info, record.trueOutputs[iCfg], false);
+        }
+      }
+      if (DoJetMatching()) {
+        Monitor::Timer timer(m_monitor, Monitor::STAGE::MATCH);
+        m_jetMatcher.Match(m_recoClusterers[iCfg].GetJets(), m_trueClusterers[iCfg].GetJets(), m_recoProv.matchID, m_trueProv.matchID);
+        if (m_doFlatOutput) {
+          m_jetMatcher.FillRecoColumns(record.recoFlatOutputs[iCfg].match);
+          m_jetMatcher.FillTrueColumns(record.trueFlatOutputs[iCfg].match);
+        } else {
+          m_jetMatcher.FillRecoColumns(record.recoOutputs[iCfg].match);
+          m_jetMatcher.FillTrueColumns(record.trueOutputs[iCfg].match);
+        }
+      }
+    }  // end configuration loop
+
+    m_recordQueue.Push(move(record));
+    ++m_nSubmitted;
+    return;
+
+  }  // end 'SubmitRecord()'
+
+
+
+  void SCorrelatorJetTreeMaker::RunBatchWorker(const size_t iThread) {
+
+    // each worker owns a set of clusterers, a background estimator,
+    // and a jet matcher. the finders are copies of the ones built in
+    // InitJetFinders/InitBkgd (which the main thread doesn't touch in
+    // batch mode), so every worker uses the same ghost grids as the
+    // serial path and no ghosts are generated off the main thread
+    vector<SCorrelatorJetTreeMakerClusterer>    recoClusterers(m_recoClusterers);
+    vector<SCorrelatorJetTreeMakerClusterer>    trueClusterers(m_trueClusterers);
+    SCorrelatorJetTreeMakerBkgdEstimator        bkgdEstimator(m_bkgdEstimator);
+    const SCorrelatorJetTreeMakerBkgdEstimator* bkgd = DoBkgdSubtraction() ? &bkgdEstimator : NULL;
+
+    SCorrelatorJetTreeMakerJetMatcher jetMatcher;
+    jetMatcher.SetConfig(m_matchConfig);
+
+    // cluster and build output records until the queue is closed;
+    // QA histograms are filled by the writer
+    const size_t                         nJetConfigs = m_jetConfigs.size();
+    Monitor&                             monitor     = m_batchMonitors[iThread];
+    SCorrelatorJetTreeMakerEventSnapshot snapshot;
+    while (m_snapshotQueue.Pop(snapshot)) {
+
+      SCorrelatorJetTreeMakerEventRecord record;
+      record.index           = snapshot.index;
+      snapshot.info.recoProv = &snapshot.recoProv;
+      snapshot.info.trueProv = &snapshot.trueProv;
+      if (m_doFlatOutput) {
+        record.recoFlatOutputs.resize(nJetConfigs);
+        record.trueFlatOutputs.resize(m_isMC ? nJetConfigs : 0);
+      } else {
+        record.recoOutputs.resize(nJetConfigs);
+        record.trueOutputs.resize(m_isMC ? nJetConfigs : 0);
+      }
+
+      // reco jets for every configuration first, so that the
+      // background estimate can reuse a kt configuration
+      {
+        Monitor::Timer timer(monitor, Monitor::STAGE::RECO_CLUST);
+        for (SCorrelatorJetTreeMakerClusterer& clusterer : recoClusterers) {
+          clusterer.Cluster(snapshot.recoCsts);
+          monitor.Count(Monitor::COUNT::NRECO_JET, clusterer.GetJets().size());
+        }
+        if (bkgd) {
+          bkgdEstimator.Estimate(snapshot.recoCsts, (m_bkgdKtCfg >= 0) ? &recoClusterers[m_bkgdKtCfg] : NULL);
+        }
+      }
+
+      for (size_t iCfg = 0; iCfg < nJetConfigs; iCfg++) {
+
+        // reco output
+        {
+          Monitor::Timer timer(monitor, Monitor::STAGE::RECO_FILL);
+          if (m_doFlatOutput) {
+            FillRecoOutput(recoClusterers[iCfg].GetJets(), snapshot.info, bkgd, record.recoFlatOutputs[iCfg], false);
+          } else {
+            FillRecoOutput(recoClusterers[iCfg].GetJets(), snapshot.info, bkgd, record.recoOutputs[iCfg], false);
+          }
+        }
+        if (!m_isMC) {
+          continue;
+        }
+
+        // truth jets
+        {
+          Monitor::Timer timer(monitor, Monitor::STAGE::TRUE_CLUST);
+          trueClusterers[iCfg].Cluster(snapshot.trueCsts);
+          monitor.Count(Monitor::COUNT::NTRUE_JET, trueClusterers[iCfg].GetJets().size());
+        }
+        {
+          Monitor::Timer timer(monitor, Monitor::STAGE::TRUE_FILL);
+          if (m_doFlatOutput) {
+            FillTrueOutput(trueClusterers[iCfg].GetJets(), snapshot.info, record.trueFlatOutputs[iCfg], false);
+          } else {
+            FillTrueOutput(trueClusterers[iCfg].GetJets(), snapshot.info, record.trueOutputs[iCfg], false);
+          }
+        }
+
+        // matches (after both outputs were filled)
+        if (DoJetMatching()) {
+          Monitor::Timer timer(monitor, Monitor::STAGE::MATCH);
+          jetMatcher.Match(recoClusterers[iCfg].GetJets(), trueClusterers[iCfg].GetJets(), snapshot.recoProv.matchID, snapshot.trueProv.matchID);
+          if (m_doFlatOutput) {
+            jetMatcher.FillRecoColumns(record.recoFlatOutputs[iCfg].match);
+            jetMatcher.FillTrueColumns(record.trueFlatOutputs[iCfg].match);
+          } else {
+            jetMatcher.FillRecoColumns(record.recoOutputs[iCfg].match);
+            jetMatcher.FillTrueColumns(record.trueOutputs[iCfg].match);
+          }
+        }
+      }  // end configuration loop
+      m_recordQueue.Push(move(record));
+
+      // hand buffers back to the event loop (dropped if it has enough)
+      m_freeSnapshots.TryPush(move(snapshot));
+    }  // end snapshot loop
+    return;
+
+  }  // end 'RunBatchWorker(size_t)'
+
+
+
+  void SCorrelatorJetTreeMaker::RunBatchWriter() {
+
+    // records can arrive out of order: hold on to them
+    // until the next event in input order is available
+    uint64_t                                          iNext   = 0;
+    Monitor&                                          monitor = m_batchMonitors.back();
+    map<uint64_t, SCorrelatorJetTreeMakerEventRecord> pending;
+    SCorrelatorJetTreeMakerEventRecord                record;
+    while (m_recordQueue.Pop(record)) {
+
+      const uint64_t index = record.index;
+      pending.emplace(index, move(record));
+
+      map<uint64_t, SCorrelatorJetTreeMakerEventRecord>::iterator itNext = pending.find(iNext);
+      while (itNext != pending.end()) {
+        WriteRecord(itNext -> second, monitor);
+        if (IsAsyncWrite()) {
+          m_freeRecords.Push(move(itNext -> second));
+        }
+        pending.erase(itNext);
+        ++iNext;
+
+        // let producer know there's room
+        {
+          lock_guard<mutex> lock(m_batchMutex);
+          ++m_nWritten;
+        }
+        m_batchCond.notify_all();
+        itNext = pending.find(iNext);
+      }
+    }  // end record loop
+
+    // all records should have been written in order by now
+    if (!pending.empty()) {
+      cerr << "SCorrelatorJetTreeMaker::RunBatchWriter() WARNING: " << pending.size() << " records were never written!" << endl;
+    }
+    return;
+
+  }  // end 'RunBatchWriter()'
+
+
+
+  void SCorrelatorJetTreeMaker::WriteRecord(SCorrelatorJetTreeMakerEventRecord& record, Monitor& monitor) {
+
+    // time tree filling
+    Monitor::Timer timer(monitor, Monitor::STAGE::WRITE);
+
+    // swap record into the outputs bound to the trees (the output
+    // structs themselves stay put, so branch addresses stay valid,
+    // and the record is left holding the previous event's buffers)
+    for (size_t iCfg = 0; iCfg < m_jetConfigs.size(); iCfg++) {
+
+      const bool doQA   = (iCfg == 0);
+      int        nBytes = 0;
+      if (m_doFlatOutput) {
+        swap(m_recoFlatOutputs[iCfg], record.recoFlatOutputs[iCfg]);
+        if (doQA) {
+          FillJetQA(m_recoFlatOutputs[iCfg], false);
+        }
+        nBytes = FillTree(m_recoTrees[iCfg], m_recoNTuples[iCfg].get(), m_recoParquets[iCfg].get(), m_recoFlatOutputs[iCfg]);
+      } else {
+        swap(m_recoOutputs[iCfg], record.recoOutputs[iCfg]);
+        if (doQA) {
+          FillJetQA(m_recoOutputs[iCfg], false);
+        }
+        nBytes = FillTree(m_recoTrees[iCfg], m_recoNTuples[iCfg].get(), m_recoParquets[iCfg].get(), m_recoOutputs[iCfg]);
+      }
+      monitor.Count(Monitor::COUNT::NBYTES_FILLED, max(nBytes, 0));
+      if (!m_isMC) {
+        continue;
+      }
+
+      if (m_doFlatOutput) {
+        swap(m_trueFlatOutputs[iCfg], record.trueFlatOutputs[iCfg]);
+        if (doQA) {
+          FillJetQA(m_trueFlatOutputs[iCfg], true);
+        }
+        nBytes = FillTree(m_trueTrees[iCfg], m_trueNTuples[iCfg].get(), m_trueParquets[iCfg].get(), m_trueFlatOutputs[iCfg]);
+      } else {
+        swap(m_trueOutputs[iCfg], record.trueOutputs[iCfg]);
+        if (doQA) {
+          FillJetQA(m_trueOutputs[iCfg], true);
+        }
+        nBytes = FillTree(m_trueTrees[iCfg], m_trueNTuples[iCfg].get(), m_trueParquets[iCfg].get(), m_trueOutputs[iCfg]);
+      }
+      monitor.Count(Monitor::COUNT::NBYTES_FILLED, max(nBytes, 0));
+    }
+    return;
+
+  }  // end 'WriteRecord(SCorrelatorJetTreeMakerEventRecord&, Monitor&)'
+
+
+
+  template <typename TOutput> void SCorrelatorJetTreeMaker::FillJetQA(const TOutput& output, const bool isTruth) {
+
+    // same QA as FillTrueOutput/FillRecoOutput, but
+    // read back from an already filled output
+    const size_t iJetHist = isTruth ? 0 : 1;
+    const size_t iJetObj  = isTruth ? OBJECT::TJET : OBJECT::RJET;
+    const size_t iCstObj  = isTruth ? OBJECT::TCST : OBJECT::RCST;
+    for (size_t iJet = 0; iJet < output.jetPt.size(); iJet++) {
+      m_hJetArea[iJetHist]                -> Fill(output.jetArea[iJet]);
+      m_hJetNumCst[iJetHist]              -> Fill(output.jetNCst[iJet]);
+      m_hObjectQA[iJetObj][INFO::PT]      -> Fill(output.jetPt[iJet]);
+      m_hObjectQA[iJetObj][INFO::ETA]     -> Fill(output.jetEta[iJet]);
+      m_hObjectQA[iJetObj][INFO::PHI]     -> Fill(output.jetPhi[iJet]);
+      m_hObjectQA[iJetObj][INFO::ENE]     -> Fill(output.jetE[iJet]);
+    }
+    const size_t nCst = FillCstQA(m_hObjectQA[iCstObj][INFO::PT], output.cstPt);
+    FillCstQA(m_hObjectQA[iCstObj][INFO::ETA], output.cstEta);
+    FillCstQA(m_hObjectQA[iCstObj][INFO::PHI], output.cstPhi);
+    FillCstQA(m_hObjectQA[iCstObj][INFO::ENE], output.cstE);
+    m_hNumObject[iJetObj] -> Fill(output.jetPt.size());
+    m_hNumObject[iCstObj] -> Fill(nCst);
+    return;
+
+  }  // end 'FillJetQA(TOutput&, bool)'
+
+
+
+  size_t SCorrelatorJetTreeMaker::FillCstQA(TH1* hist, const vector<double>& values) {
+
+    // flat layout
+    for (const double value : values) {
+      hist -> Fill(value);
+    }
+    return values.size();
+
+  }  // end 'FillCstQA(TH1*, vector<double>&)'
+
+
+
+  size_t SCorrelatorJetTreeMaker::FillCstQA(TH1* hist, const vector<vector<double>>& values) {
+
+    // legacy (jet-nested) layout
+    size_t nValues = 0;
+    for (const vector<double>& jetValues : values) {
+      nValues += FillCstQA(hist, jetValues);
+    }
+    return nValues;
+
+  }  // end 'FillCstQA(TH1*, vector<vector<double>>&)'
+
+
+
+  void SCorrelatorJetTreeMaker::StopBatch() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::StopBatch() Draining queues and stopping threads..." << endl;
+    }
+
+    // no more snapshots: let workers finish what's queued
+    m_snapshotQueue.Close();
+    for (thread& worker : m_batchWorkers) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    m_batchWorkers.clear();
+
+    // then let the writer flush every remaining record; after the
+    // join the output file is back with the main thread (see StartBatch)
+    m_recordQueue.Close();
+    if (m_batchWriter.joinable()) {
+      m_batchWriter.join();
+    }
+
+    // and release the spare snapshot and write buffers
+    m_freeSnapshots.Open();
+    if (IsAsyncWrite()) {
+      m_freeRecords.Open();
+    }
+
+    // collect timing and counters
+    for (const Monitor& monitor : m_batchMonitors) {
+      m_monitor.Merge(monitor);
+    }
+    m_batchMonitors.clear();
+    return;
+
+  }  // end 'StopBatch()'
+
+
+
+  bool SCorrelatorJetTreeMaker::IsAsyncWrite() const {
+
+    // batch mode always writes asynchronously, so the
+    // double-buffered path is only used without workers
+    return (m_doAsyncWrite && (m_nBatchThreads == 0));
+
+  }  // end 'IsAsyncWrite()'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
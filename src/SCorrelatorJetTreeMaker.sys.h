@@ -33,10 +33,11 @@ namespace SColdQcdCorrelatorAnalysis {
     m_partonID[1]  = -9999;
     m_partonMom[0] = CLHEP::Hep3Vector(-9999., -9999., -9999.);
     m_partonMom[1] = CLHEP::Hep3Vector(-9999., -9999., -9999.);
-    m_recoJets.clear();
-    m_trueJets.clear();
+    m_recoCsts.clear();
+    m_trueCsts.clear();
     m_vecEvtsToGrab.clear();
-    m_mapCstToEmbedID.clear();
+    m_recoProv.Reset();
+    m_trueProv.Reset();
     return;
 
   }  // end 'InitVariables()'
@@ -53,19 +54,115 @@ namespace SColdQcdCorrelatorAnalysis {
     // pt range of functions
     const pair<float, float> ptRange = {0., 100.};
 
-    // initialize functions
-    m_fSigDcaXY = new TF1("fSigmaDcaXY", "[0]+[1]/x+[2]/(x*x)", ptRange.first, ptRange.second);
-    m_fSigDcaZ  = new TF1("fSigmaDcaZ",  "[0]+[1]/x+[2]/(x*x)", ptRange.first, ptRange.second);
+    // initialize functions (only used to record the dca width
+    // parametrization: the cut itself uses the compiled model)
+    const string sSigDca = SCorrelatorJetTreeMakerDcaSigmaModel::GetFormula();
+    m_fSigDcaXY = new TF1("fSigmaDcaXY", sSigDca.data(), ptRange.first, ptRange.second);
+    m_fSigDcaZ  = new TF1("fSigmaDcaZ",  sSigDca.data(), ptRange.first, ptRange.second);
     for (uint8_t iParam = 0; iParam < CONST::NParam; iParam++) {
       m_fSigDcaXY -> SetParameter(iParam, m_parSigDcaXY[iParam]);
       m_fSigDcaZ  -> SetParameter(iParam, m_parSigDcaZ[iParam]);
     }
+
+    // set cuts for batch track selection
+    m_trkSelector.SetCuts(GetTrackCuts());
+
+    // set cuts for batch particle selection, and cache charges
+    // of common species so truth selection doesn't look them up
+    if (m_isMC) {
+      m_parSelector.SetCuts(GetParticleCuts());
+      m_chrgTable.Build([](const int pdg) -> float {return GetParticleCharge(pdg);});
+    }
+
+    // dead tpc sectors are picked up per run in InitRun()
+    if (m_maskTpcSectors && !m_tpcDeadSectorFile.empty()) {
+      m_tpcDeadSectors.Load(m_tpcDeadSectorFile);
+    }
     return;
 
   }  // end 'InitFuncs()'
 
 
 
+  void SCorrelatorJetTreeMaker::InitJetFinders() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::InitJetFinders() Initializing jet finders..." << endl;
+    }
+
+    // the nominal configuration (from SetJetParameters, written to
+    // the untagged trees) always comes first; added configurations
+    // are clustered on top of it
+    if (m_jetConfigs.empty() || !m_jetConfigs.front().tag.empty()) {
+      SCorrelatorJetTreeMakerJetConfig jetConfig;
+      jetConfig.rJet   = m_jetR;
+      jetConfig.algo   = m_jetAlgo;
+      jetConfig.recomb = m_recombScheme;
+      jetConfig.tag    = "";
+      m_jetConfigs.insert(m_jetConfigs.begin(), jetConfig);
+    }
+
+    // drop added configurations which repeat the nominal one
+    const SCorrelatorJetTreeMakerJetConfig& nominal = m_jetConfigs.front();
+    for (size_t iCfg = m_jetConfigs.size() - 1; iCfg > 0; iCfg--) {
+      const bool isSameAlgo   = (m_jetConfigs[iCfg].algo   == nominal.algo);
+      const bool isSameRecomb = (m_jetConfigs[iCfg].recomb == nominal.recomb);
+      const bool isSameRad    = (abs(m_jetConfigs[iCfg].rJet - nominal.rJet) < numeric_limits<float>::epsilon());
+      if (isSameAlgo && isSameRecomb && isSameRad) {
+        cerr << "SCorrelatorJetTreeMaker::InitJetFinders() WARNING: added jet configuration " << m_jetConfigs[iCfg].tag << " is the nominal one, dropping it!" << endl;
+        m_jetConfigs.erase(m_jetConfigs.begin() + iCfg);
+      }
+    }
+
+    // background subtraction may need to turn on jet areas first
+    if (DoBkgdSubtraction()) {
+      InitBkgd();
+    }
+
+    // matching runs over each configuration in turn
+    m_jetMatcher.SetConfig(m_matchConfig);
+
+    // jet definitions (and ghost grids, if computing
+    // areas) are created once and reused for every event
+    m_trueClusterers.clear();
+    m_recoClusterers.clear();
+    for (const SCorrelatorJetTreeMakerJetConfig& jetConfig : m_jetConfigs) {
+      const SCorrelatorJetTreeMakerAreaConfig areaConfig = GetAreaConfig(jetConfig);
+      m_recoClusterers.emplace_back(jetConfig.GetJetDefinition());
+      m_recoClusterers.back().SetAreaConfig(areaConfig);
+      if (m_isMC) {
+        m_trueClusterers.emplace_back(jetConfig.GetJetDefinition());
+        m_trueClusterers.back().SetAreaConfig(areaConfig);
+      }
+    }
+
+    // track-cut variations are only handled in the (serial) event loop
+    // and are only written to trees
+    const bool canVary = (m_addTracks && m_doTreeOutput && (m_nBatchThreads == 0) && !m_doAsyncWrite);
+    if (!m_trkVariations.empty() && !canVary) {
+      cerr << "SCorrelatorJetTreeMaker::InitJetFinders() WARNING: track-cut variations need tracks, tree output, and no batch mode or async writing! Ignoring variations." << endl;
+      m_trkVariations.clear();
+    }
+
+    // each variation gets its own selector and finders
+    m_varSelectors.clear();
+    m_varClusterers.clear();
+    m_varRecoCsts.assign(m_trkVariations.size(), vector<PseudoJet>());
+    for (const SCorrelatorJetTreeMakerTrackCutVariation& variation : m_trkVariations) {
+      m_varSelectors.emplace_back(variation.cuts);
+      m_varClusterers.emplace_back();
+      for (const SCorrelatorJetTreeMakerJetConfig& jetConfig : m_jetConfigs) {
+        m_varClusterers.back().emplace_back(jetConfig.GetJetDefinition());
+        m_varClusterers.back().back().SetAreaConfig(GetAreaConfig(jetConfig));
+      }
+    }
+    return;
+
+  }  // end 'InitJetFinders()'
+
+
+
   void SCorrelatorJetTreeMaker::InitTrees() {
 
     // print debug statement
@@ -73,9 +170,113 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::InitTrees() Initializing output trees..." << endl;
     }
 
-    // initialize trees
-    m_trueTree = new TTree("TruthJetTree", "A tree of truth jets");
-    m_recoTree = new TTree("RecoJetTree",  "A tree of reconstructed jets");
+    // size output before binding branches so addresses stay put
+    const size_t nJetConfigs = m_jetConfigs.size();
+    m_trueTrees.resize(nJetConfigs, NULL);
+    m_recoTrees.resize(nJetConfigs, NULL);
+    m_trueNTuples.resize(nJetConfigs);
+    m_recoNTuples.resize(nJetConfigs);
+    m_trueParquets.resize(nJetConfigs);
+    m_recoParquets.resize(nJetConfigs);
+    if (m_doFlatOutput) {
+      m_trueFlatOutputs.resize(nJetConfigs);
+      m_recoFlatOutputs.resize(nJetConfigs);
+    } else {
+      m_trueOutputs.resize(nJetConfigs);
+      m_recoOutputs.resize(nJetConfigs);
+    }
+
+    // and likewise for track-cut variations
+    const size_t nVariations = m_trkVariations.size();
+    m_varTrees.assign(nVariations, vector<TTree*>(nJetConfigs, NULL));
+    if (m_doFlatOutput) {
+      m_varFlatOutputs.assign(nVariations, vector<SCorrelatorJetTreeMakerFlatRecoOutput>(nJetConfigs));
+    } else {
+      m_varOutputs.assign(nVariations, vector<SCorrelatorJetTreeMakerLegacyRecoOutput>(nJetConfigs));
+    }
+
+    // initialize a pair of trees and/or rntuples for each jet configuration
+    for (size_t iCfg = 0; iCfg < nJetConfigs; iCfg++) {
+
+      // add configuration tag to names if needed
+      const string tag       = m_jetConfigs[iCfg].tag;
+      const string suffix    = tag.empty() ? "" : "_" + tag;
+      const string trueName  = "TruthJetTree" + suffix;
+      const string recoName  = "RecoJetTree"  + suffix;
+      const string trueTitle = tag.empty() ? "A tree of truth jets"         : "A tree of truth jets (" + tag + ")";
+      const string recoTitle = tag.empty() ? "A tree of reconstructed jets" : "A tree of reconstructed jets (" + tag + ")";
+
+      if (m_doTreeOutput) {
+        m_recoTrees[iCfg] = new TTree(recoName.data(), recoTitle.data());
+        if (m_doFlatOutput) {
+          m_recoFlatOutputs[iCfg].SetTreeAddresses(m_recoTrees[iCfg], m_doFloatOutput);
+        } else {
+          m_recoOutputs[iCfg].SetTreeAddresses(m_recoTrees[iCfg], m_doFloatOutput);
+        }
+        if (DoBkgdSubtraction()) {
+          if (m_doFlatOutput) {
+            m_recoFlatOutputs[iCfg].bkgd.SetTreeAddresses(m_recoTrees[iCfg], m_bkgdConfig.doCstSub);
+          } else {
+            m_recoOutputs[iCfg].bkgd.SetTreeAddresses(m_recoTrees[iCfg], m_bkgdConfig.doCstSub);
+          }
+        }
+        if (DoJetMatching()) {
+          if (m_doFlatOutput) {
+            m_recoFlatOutputs[iCfg].match.SetTreeAddresses(m_recoTrees[iCfg]);
+          } else {
+            m_recoOutputs[iCfg].match.SetTreeAddresses(m_recoTrees[iCfg]);
+          }
+        }
+        m_writeConfig.Apply(m_recoTrees[iCfg]);
+
+        if (m_isMC) {
+          m_trueTrees[iCfg] = new TTree(trueName.data(), trueTitle.data());
+          if (m_doFlatOutput) {
+            m_trueFlatOutputs[iCfg].SetTreeAddresses(m_trueTrees[iCfg], m_doFloatOutput);
+          } else {
+            m_trueOutputs[iCfg].SetTreeAddresses(m_trueTrees[iCfg], m_doFloatOutput);
+          }
+          if (DoJetMatching()) {
+            if (m_doFlatOutput) {
+              m_trueFlatOutputs[iCfg].match.SetTreeAddresses(m_trueTrees[iCfg]);
+            } else {
+              m_trueOutputs[iCfg].match.SetTreeAddresses(m_trueTrees[iCfg]);
+            }
+          }
+          m_writeConfig.Apply(m_trueTrees[iCfg]);
+        }
+
+        // reco trees for track-cut variations are named '<reco tree>_<variation>'
+        for (size_t iVar = 0; iVar < nVariations; iVar++) {
+          const string varName  = recoName + "_" + m_trkVariations[iVar].name;
+          const string varTitle = recoTitle + " [track cuts: " + m_trkVariations[iVar].name + "]";
+
+          m_varTrees[iVar][iCfg] = new TTree(varName.data(), varTitle.data());
+          if (m_doFlatOutput) {
+            m_varFlatOutputs[iVar][iCfg].SetTreeAddresses(m_varTrees[iVar][iCfg], m_doFloatOutput);
+          } else {
+            m_varOutputs[iVar][iCfg].SetTreeAddresses(m_varTrees[iVar][iCfg], m_doFloatOutput);
+          }
+          m_writeConfig.Apply(m_varTrees[iVar][iCfg]);
+        }
+      }
+
+      // rntuples hold one event-model struct per entry
+      if (m_doNTupleOutput) {
+        m_recoNTuples[iCfg].reset(new SCorrelatorJetTreeMakerNTupleWriter<SCorrelatorJetTreeMakerRecoOutput>("RecoJetNTuple" + suffix, "Event", m_outFile, m_writeConfig));
+        if (m_isMC) {
+          m_trueNTuples[iCfg].reset(new SCorrelatorJetTreeMakerNTupleWriter<SCorrelatorJetTreeMakerTruthOutput>("TruthJetNTuple" + suffix, "Event", m_outFile, m_writeConfig));
+        }
+      }
+
+      // parquet sinks write separate event, jet, and constituent files
+      if (m_doParquetOutput) {
+        m_recoParquets[iCfg].reset(new SCorrelatorJetTreeMakerParquetSink<SCorrelatorJetTreeMakerRecoOutput>(m_parquetBaseName + "_RecoJets" + suffix, m_parquetRowGroupSize, m_writeConfig));
+        if (m_isMC) {
+          m_trueParquets[iCfg].reset(new SCorrelatorJetTreeMakerParquetSink<SCorrelatorJetTreeMakerTruthOutput>(m_parquetBaseName + "_TruthJets" + suffix, m_parquetRowGroupSize, m_writeConfig));
+        }
+      }
+    }  // end configuration loop
     return;
 
   }  // end 'InitTrees()'
@@ -89,96 +290,205 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::InitEvals(PHCompositeNode*) Initializing evaluators..." << endl;
     }
 
-    m_evalStack = new SvtxEvalStack(topNode);
+    // build evaluator stack once on the first event: afterwards it's
+    // only advanced so that its caches are reset rather than rebuilt
     if (!m_evalStack) {
-      cerr << "SCorrelatorJetTreeMaker::InitEvals(PHCompositeNode*) PANIC: couldn't grab SvtxEvalStack! Aborting!" << endl;
-      assert(m_evalStack);
+      m_evalStack = new SvtxEvalStack(topNode);
+      if (!m_evalStack) {
+        cerr << "SCorrelatorJetTreeMaker::InitEvals(PHCompositeNode*) PANIC: couldn't grab SvtxEvalStack! Aborting!" << endl;
+        assert(m_evalStack);
+      }
+
+      m_trackEval = m_evalStack -> get_track_eval();
+      if (!m_trackEval) {
+        cerr << "SCorrelatorJetTreeMaker::InitEvals(PHCompositeNode*) PANIC: couldn't grab track evaluator! Aborting!" << endl;
+        assert(m_trackEval);
+      }
+    }
+    m_evalStack -> next_event(topNode);
+
+    // matches are only valid for the current event
+    m_matchIDs.clear();
+    return;
+
+  }  // end 'InitEvals(PHCompositeNode*)'
+
+
+
+  void SCorrelatorJetTreeMaker::FillTrueTree(const size_t iCfg) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillTrueTree(size_t) Filling truth jet tree #" << iCfg << "..." << endl;
+    }
+
+    // time tree filling
+    Monitor::Timer timer(m_monitor, Monitor::STAGE::TRUE_FILL);
+
+    // QA histograms only track the primary jet configuration
+    const bool                             doQA = (iCfg == 0);
+    const SCorrelatorJetTreeMakerEventInfo info = GetEventInfo();
+
+    // fill output in requested layout and then output tree
+    int nBytes = 0;
+    if (m_doFlatOutput) {
+      FillTrueOutput(m_trueClusterers[iCfg].GetJets(), info, m_trueFlatOutputs[iCfg], doQA);
+      if (DoJetMatching()) {
+        m_jetMatcher.FillTrueColumns(m_trueFlatOutputs[iCfg].match);
+      }
+      nBytes = FillTree(m_trueTrees[iCfg], m_trueNTuples[iCfg].get(), m_trueParquets[iCfg].get(), m_trueFlatOutputs[iCfg]);
     } else {
-      m_evalStack -> next_event(topNode);
+      FillTrueOutput(m_trueClusterers[iCfg].GetJets(), info, m_trueOutputs[iCfg], doQA);
+      if (DoJetMatching()) {
+        m_jetMatcher.FillTrueColumns(m_trueOutputs[iCfg].match);
+      }
+      nBytes = FillTree(m_trueTrees[iCfg], m_trueNTuples[iCfg].get(), m_trueParquets[iCfg].get(), m_trueOutputs[iCfg]);
     }
+    m_monitor.Count(Monitor::COUNT::NBYTES_FILLED, max(nBytes, 0));
+    return;
+
+  }  // end 'FillTrueTree(size_t)'
+
+
+
+  void SCorrelatorJetTreeMaker::FillRecoTree(const size_t iCfg) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillRecoTree(size_t) Filling reco jet tree #" << iCfg << "..." << endl;
+    }
+
+    // time tree filling
+    Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_FILL);
+
+    // QA histograms only track the primary jet configuration
+    const bool                                  doQA = (iCfg == 0);
+    const SCorrelatorJetTreeMakerEventInfo      info = GetEventInfo();
+    const SCorrelatorJetTreeMakerBkgdEstimator* bkgd = DoBkgdSubtraction() ? &m_bkgdEstimator : NULL;
 
-    m_trackEval = m_evalStack -> get_track_eval();
-    if (!m_trackEval) {
-      cerr << "SCorrelatorJetTreeMaker::InitEvals(PHCompositeNode*) PANIC: couldn't grab track evaluator! Aborting!" << endl;
-      assert(m_trackEval);
+    // fill output in requested layout and then object tree
+    int nBytes = 0;
+    if (m_doFlatOutput) {
+      FillRecoOutput(m_recoClusterers[iCfg].GetJets(), info, bkgd, m_recoFlatOutputs[iCfg], doQA);
+      if (DoJetMatching()) {
+        m_jetMatcher.FillRecoColumns(m_recoFlatOutputs[iCfg].match);
+      }
+      nBytes = FillTree(m_recoTrees[iCfg], m_recoNTuples[iCfg].get(), m_recoParquets[iCfg].get(), m_recoFlatOutputs[iCfg]);
+    } else {
+      FillRecoOutput(m_recoClusterers[iCfg].GetJets(), info, bkgd, m_recoOutputs[iCfg], doQA);
+      if (DoJetMatching()) {
+        m_jetMatcher.FillRecoColumns(m_recoOutputs[iCfg].match);
+      }
+      nBytes = FillTree(m_recoTrees[iCfg], m_recoNTuples[iCfg].get(), m_recoParquets[iCfg].get(), m_recoOutputs[iCfg]);
     }
+    m_monitor.Count(Monitor::COUNT::NBYTES_FILLED, max(nBytes, 0));
     return;
 
-  }  // end 'InitEvals(PHCompositeNode*)'
+  }  // end 'FillRecoTree(size_t)'
 
 
 
-  void SCorrelatorJetTreeMaker::FillTrueTree() {
+  void SCorrelatorJetTreeMaker::FillVariationTrees(const size_t iCfg) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::FillTrueTree() Filling truth jet tree..." << endl;
-    }
-
-    // prepare vectors for filling
-    m_trueJetNCst.clear();
-    m_trueJetID.clear();
-    m_trueJetE.clear();
-    m_trueJetPt.clear();
-    m_trueJetEta.clear();
-    m_trueJetPhi.clear();
-    m_trueJetArea.clear();
-    m_trueCstID.clear();
-    m_trueCstEmbedID.clear();
-    m_trueCstZ.clear();
-    m_trueCstDr.clear();
-    m_trueCstE.clear();
-    m_trueCstPt.clear();
-    m_trueCstEta.clear();
-    m_trueCstPhi.clear();
-
-    // declare vectors to storing constituents
-    vector<int>    vecTruCstID;
-    vector<int>    vecTruCstEmbedID;
-    vector<double> vecTruCstZ;
-    vector<double> vecTruCstDr;
-    vector<double> vecTruCstE;
-    vector<double> vecTruCstPt;
-    vector<double> vecTruCstEta;
-    vector<double> vecTruCstPhi;
-    vecTruCstID.clear();
-    vecTruCstZ.clear();
-    vecTruCstDr.clear();
-    vecTruCstE.clear();
-    vecTruCstPt.clear();
-    vecTruCstEta.clear();
-    vecTruCstPhi.clear();
+      cout << "SCorrelatorJetTreeMaker::FillVariationTrees(size_t) Filling track-cut variation trees for configuration #" << iCfg << "..." << endl;
+    }
+
+    // time tree filling
+    Monitor::Timer timer(m_monitor, Monitor::STAGE::RECO_FILL);
+
+    // QA histograms, background subtraction, and matching
+    // only cover the nominal cuts
+    const SCorrelatorJetTreeMakerEventInfo info = GetEventInfo();
+    for (size_t iVar = 0; iVar < m_trkVariations.size(); iVar++) {
+      int nBytes = 0;
+      if (m_doFlatOutput) {
+        FillRecoOutput(m_varClusterers[iVar][iCfg].GetJets(), info, NULL, m_varFlatOutputs[iVar][iCfg], false);
+        if (m_doFloatOutput) {
+          m_varFlatOutputs[iVar][iCfg].Reduce(m_precision);
+        }
+        nBytes = m_varTrees[iVar][iCfg] -> Fill();
+      } else {
+        FillRecoOutput(m_varClusterers[iVar][iCfg].GetJets(), info, NULL, m_varOutputs[iVar][iCfg], false);
+        if (m_doFloatOutput) {
+          m_varOutputs[iVar][iCfg].Reduce(m_precision);
+        }
+        nBytes = m_varTrees[iVar][iCfg] -> Fill();
+      }
+      m_monitor.Count(Monitor::COUNT::NBYTES_FILLED, max(nBytes, 0));
+    }
+    return;
+
+  }  // end 'FillVariationTrees(size_t)'
+
+
+
+  template <typename TOutput, typename TEvent> int SCorrelatorJetTreeMaker::FillTree(TTree* tree, SCorrelatorJetTreeMakerNTupleWriter<TEvent>* ntuple, SCorrelatorJetTreeMakerParquetSink<TEvent>* parquet, TOutput& output) {
+
+    // tree (either is NULL if its backend is off)
+    int nBytes = 0;
+    if (tree) {
+      if (m_doFloatOutput) {
+        output.Reduce(m_precision);
+      }
+      nBytes = tree -> Fill();
+    }
+
+    // rntuple: convert to event model first
+    if (ntuple) {
+      output.GetTreeMakerOutput(ntuple -> GetEvent());
+      ntuple -> Fill();
+    }
+
+    // parquet: reuse the rntuple's conversion if there is one
+    if (parquet) {
+      if (ntuple) {
+        parquet -> Write(ntuple -> GetEvent());
+      } else {
+        output.GetTreeMakerOutput(parquet -> GetEvent());
+        parquet -> Fill();
+      }
+    }
+    return nBytes;
+
+  }  // end 'FillTree(TTree*, SCorrelatorJetTreeMakerNTupleWriter<TEvent>*, SCorrelatorJetTreeMakerParquetSink<TEvent>*, TOutput&)'
+
+
+
+  template <typename TOutput> void SCorrelatorJetTreeMaker::FillTrueOutput(const vector<PseudoJet>& trueJets, const SCorrelatorJetTreeMakerEventInfo& info, TOutput& output, const bool doQA) {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::FillTrueOutput(vector<PseudoJet>&, SCorrelatorJetTreeMakerEventInfo&, TOutput&, bool) Filling truth jet output..." << endl;
+    }
+
+    // prepare output for filling
+    output.Reset();
 
     // fill jets/constituent variables
     unsigned int nTruJet(0);
     unsigned int nTruCst(0);
-    for (unsigned int iTruJet = 0; iTruJet < m_trueJets.size(); ++iTruJet) {
+    for (unsigned int iTruJet = 0; iTruJet < trueJets.size(); ++iTruJet) {
 
       // get jet info
-      const unsigned int jetNCst  = m_trueJets[iTruJet].constituents().size();
-      const unsigned int jetTruID = iTruJet;
-      const double       jetPhi   = m_trueJets[iTruJet].phi_std();
-      const double       jetEta   = m_trueJets[iTruJet].pseudorapidity();
-      const double       jetArea  = 0.;  // FIXME: jet area needs to be defined
-      const double       jetE     = m_trueJets[iTruJet].E();
-      const double       jetPt    = m_trueJets[iTruJet].perp();
-      const double       jetPx    = m_trueJets[iTruJet].px();
-      const double       jetPy    = m_trueJets[iTruJet].py();
-      const double       jetPz    = m_trueJets[iTruJet].pz();
-      const double       jetP     = sqrt((jetPx * jetPx) + (jetPy * jetPy) + (jetPz * jetPz));
-
-      // clear constituent vectors
-      vecTruCstID.clear();
-      vecTruCstEmbedID.clear();
-      vecTruCstZ.clear();
-      vecTruCstDr.clear();
-      vecTruCstE.clear();
-      vecTruCstPt.clear();
-      vecTruCstEta.clear();
-      vecTruCstPhi.clear();
+      const vector<PseudoJet> trueCsts = SCorrelatorJetTreeMakerClusterer::GetConstituents(trueJets[iTruJet]);
+      const unsigned int      jetNCst  = trueCsts.size();
+      const unsigned int      jetTruID = iTruJet;
+      const double            jetPhi   = trueJets[iTruJet].phi_std();
+      const double            jetEta   = trueJets[iTruJet].pseudorapidity();
+      const double            jetArea  = SCorrelatorJetTreeMakerClusterer::GetArea(trueJets[iTruJet]);
+      const double            jetE     = trueJets[iTruJet].E();
+      const double            jetPt    = trueJets[iTruJet].perp();
+      const double            jetPx    = trueJets[iTruJet].px();
+      const double            jetPy    = trueJets[iTruJet].py();
+      const double            jetPz    = trueJets[iTruJet].pz();
+      const double            jetP     = sqrt((jetPx * jetPx) + (jetPy * jetPy) + (jetPz * jetPz));
+
+      // store jet output (constituents are appended in place)
+      output.AddJet(jetNCst, jetTruID, jetE, jetPt, jetEta, jetPhi, jetArea);
 
       // loop over constituents
-      vector<fastjet::PseudoJet> trueCsts = m_trueJets[iTruJet].constituents();
       for (unsigned int iTruCst = 0; iTruCst < trueCsts.size(); ++iTruCst) {
 
         // get constituent info
@@ -196,152 +506,112 @@ namespace SColdQcdCorrelatorAnalysis {
         const double cstDr  = sqrt((cstDf * cstDf) + (cstDh * cstDh));
 
         // get barcode and embedding ID
-        const int cstID   = trueCsts[iTruCst].user_index();
-        const int embedID = m_mapCstToEmbedID[cstID];
-
-        // add csts to vectors
-        vecTruCstID.push_back(abs(cstID));
-        vecTruCstEmbedID.push_back(embedID);
-        vecTruCstZ.push_back(cstZ);
-        vecTruCstDr.push_back(cstDr);
-        vecTruCstE.push_back(cstE);
-        vecTruCstPt.push_back(cstPt);
-        vecTruCstEta.push_back(cstEta);
-        vecTruCstPhi.push_back(cstPhi);
+        const int cstID   = info.GetTrueCstID(trueCsts[iTruCst].user_index());
+        const int embedID = info.GetTrueEmbedID(trueCsts[iTruCst].user_index());
+
+        // add csts to output
+        output.AddCst(abs(cstID), embedID, cstZ, cstDr, cstE, cstPt, cstEta, cstPhi);
 
         // fill QA histograms and increment counters
-        m_hObjectQA[OBJECT::TCST][INFO::PT]  -> Fill(cstPt);
-        m_hObjectQA[OBJECT::TCST][INFO::ETA] -> Fill(cstEta);
-        m_hObjectQA[OBJECT::TCST][INFO::PHI] -> Fill(cstPhi);
-        m_hObjectQA[OBJECT::TCST][INFO::ENE] -> Fill(cstE);
+        if (doQA) {
+          m_hObjectQA[OBJECT::TCST][INFO::PT]  -> Fill(cstPt);
+          m_hObjectQA[OBJECT::TCST][INFO::ETA] -> Fill(cstEta);
+          m_hObjectQA[OBJECT::TCST][INFO::PHI] -> Fill(cstPhi);
+          m_hObjectQA[OBJECT::TCST][INFO::ENE] -> Fill(cstE);
+        }
         ++nTruCst;
       }  // end constituent loop
 
-      // store jet/cst output
-      m_trueJetNCst.push_back(jetNCst);
-      m_trueJetID.push_back(jetTruID);
-      m_trueJetE.push_back(jetE);
-      m_trueJetPt.push_back(jetPt);
-      m_trueJetEta.push_back(jetEta);
-      m_trueJetPhi.push_back(jetPhi);
-      m_trueJetArea.push_back(jetArea);
-      m_trueCstID.push_back(vecTruCstID);
-      m_trueCstEmbedID.push_back(vecTruCstEmbedID);
-      m_trueCstZ.push_back(vecTruCstZ);
-      m_trueCstDr.push_back(vecTruCstDr);
-      m_trueCstE.push_back(vecTruCstE);
-      m_trueCstPt.push_back(vecTruCstPt);
-      m_trueCstEta.push_back(vecTruCstEta);
-      m_trueCstPhi.push_back(vecTruCstPhi);
-
       // fill QA histograms and increment counters
-      m_hJetArea[0]                        -> Fill(jetArea);
-      m_hJetNumCst[0]                      -> Fill(jetNCst);
-      m_hObjectQA[OBJECT::TJET][INFO::PT]  -> Fill(jetPt);
-      m_hObjectQA[OBJECT::TJET][INFO::ETA] -> Fill(jetEta);
-      m_hObjectQA[OBJECT::TJET][INFO::PHI] -> Fill(jetPhi);
-      m_hObjectQA[OBJECT::TJET][INFO::ENE] -> Fill(jetE);
+      if (doQA) {
+        m_hJetArea[0]                        -> Fill(jetArea);
+        m_hJetNumCst[0]                      -> Fill(jetNCst);
+        m_hObjectQA[OBJECT::TJET][INFO::PT]  -> Fill(jetPt);
+        m_hObjectQA[OBJECT::TJET][INFO::ETA] -> Fill(jetEta);
+        m_hObjectQA[OBJECT::TJET][INFO::PHI] -> Fill(jetPhi);
+        m_hObjectQA[OBJECT::TJET][INFO::ENE] -> Fill(jetE);
+      }
       ++nTruJet;
     }  // end jet loop
 
     // fill QA histograms
-    m_hNumObject[OBJECT::TJET] -> Fill(nTruJet);
-    m_hNumObject[OBJECT::TCST] -> Fill(nTruCst);
+    if (doQA) {
+      m_hNumObject[OBJECT::TJET] -> Fill(nTruJet);
+      m_hNumObject[OBJECT::TCST] -> Fill(nTruCst);
+    }
 
     // store evt info
-    m_trueNumJets       = nTruJet;
-    m_truePartonID[0]   = m_partonID[0];
-    m_truePartonID[1]   = m_partonID[1];
-    m_truePartonMomX[0] = m_partonMom[0].x();
-    m_truePartonMomX[1] = m_partonMom[1].x();
-    m_truePartonMomY[0] = m_partonMom[0].y();
-    m_truePartonMomY[1] = m_partonMom[1].y();
-    m_truePartonMomZ[0] = m_partonMom[0].z();
-    m_truePartonMomZ[1] = m_partonMom[1].z(); 
-    m_trueVtxX          = m_trueVtx.x();
-    m_trueVtxY          = m_trueVtx.y();
-    m_trueVtxZ          = m_trueVtx.z();
-
-    // fill output tree
-    m_trueTree -> Fill();
+    output.nJets     = nTruJet;
+    output.nChrgPars = info.nChrgPars;
+    output.eSumPar   = info.eSumPar;
+    output.partonID  = info.partonID;
+    output.partonPX  = info.partonPX;
+    output.partonPY  = info.partonPY;
+    output.partonPZ  = info.partonPZ;
+    output.vtxX      = info.trueVtxX;
+    output.vtxY      = info.trueVtxY;
+    output.vtxZ      = info.trueVtxZ;
     return;
 
-  }  // end 'FillTrueTree()'
+  }  // end 'FillTrueOutput(vector<PseudoJet>&, SCorrelatorJetTreeMakerEventInfo&, TOutput&, bool)'
 
 
 
-  void SCorrelatorJetTreeMaker::FillRecoTree() {
+  template <typename TOutput> void SCorrelatorJetTreeMaker::FillRecoOutput(const vector<PseudoJet>& recoJets, const SCorrelatorJetTreeMakerEventInfo& info, const SCorrelatorJetTreeMakerBkgdEstimator* bkgd, TOutput& output, const bool doQA) {
 
     // print debug statement
     if (m_doDebug) {
-      cout << "SCorrelatorJetTreeMaker::FillRecoTree() Filling reco jet tree..." << endl;
-    }
-
-    // prepare vectors for filling
-    m_recoJetNCst.clear();
-    m_recoJetID.clear();
-    m_recoJetE.clear();
-    m_recoJetPt.clear();
-    m_recoJetEta.clear();
-    m_recoJetPhi.clear();
-    m_recoJetArea.clear();
-    m_recoCstMatchID.clear();
-    m_recoCstZ.clear();
-    m_recoCstDr.clear();
-    m_recoCstE.clear();
-    m_recoCstPt.clear();
-    m_recoCstEta.clear();
-    m_recoCstPhi.clear();
-
-    // declare vectors for storing constituents
-    vector<int>    vecRecCstMatchID;
-    vector<double> vecRecCstZ;
-    vector<double> vecRecCstDr;
-    vector<double> vecRecCstE;
-    vector<double> vecRecCstPt;
-    vector<double> vecRecCstEta;
-    vector<double> vecRecCstPhi;
-    vecRecCstMatchID.clear();
-    vecRecCstZ.clear();
-    vecRecCstDr.clear();
-    vecRecCstE.clear();
-    vecRecCstPt.clear();
-    vecRecCstEta.clear();
-    vecRecCstPhi.clear();
+      cout << "SCorrelatorJetTreeMaker::FillRecoOutput(vector<PseudoJet>&, SCorrelatorJetTreeMakerEventInfo&, SCorrelatorJetTreeMakerBkgdEstimator*, TOutput&, bool) Filling reco jet output..." << endl;
+    }
+
+    // prepare output for filling
+    output.Reset();
 
     // fill jet/constituent variables
     unsigned long nRecJet(0);
     unsigned long nRecCst(0);
-    for (unsigned int iJet = 0; iJet < m_recoJets.size(); ++iJet) {
+    for (unsigned int iJet = 0; iJet < recoJets.size(); ++iJet) {
 
       // get jet info
-      const unsigned int jetNCst  = m_recoJets[iJet].constituents().size();
-      const unsigned int jetRecID = iJet;
-      const double       jetPhi   = m_recoJets[iJet].phi_std();
-      const double       jetEta   = m_recoJets[iJet].pseudorapidity();
-      const double       jetArea  = 0.;  // FIXME: jet area needs to be defined
-      const double       jetE     = m_recoJets[iJet].E();
-      const double       jetPt    = m_recoJets[iJet].perp();
-      const double       jetPx    = m_recoJets[iJet].px();
-      const double       jetPy    = m_recoJets[iJet].py();
-      const double       jetPz    = m_recoJets[iJet].pz();
-      const double       jetP     = sqrt((jetPx * jetPx) + (jetPy * jetPy) + (jetPz * jetPz));
-
-      // clear constituent vectors
-      vecRecCstMatchID.clear();
-      vecRecCstZ.clear();
-      vecRecCstDr.clear();
-      vecRecCstE.clear();
-      vecRecCstPt.clear();
-      vecRecCstEta.clear();
-      vecRecCstPhi.clear();
+      const vector<PseudoJet> recoCsts = SCorrelatorJetTreeMakerClusterer::GetConstituents(recoJets[iJet]);
+      const unsigned int      jetNCst  = recoCsts.size();
+      const unsigned int      jetRecID = iJet;
+      const double            jetPhi   = recoJets[iJet].phi_std();
+      const double            jetEta   = recoJets[iJet].pseudorapidity();
+      const double            jetArea  = SCorrelatorJetTreeMakerClusterer::GetArea(recoJets[iJet]);
+      const double            jetE     = recoJets[iJet].E();
+      const double            jetPt    = recoJets[iJet].perp();
+      const double            jetPx    = recoJets[iJet].px();
+      const double            jetPy    = recoJets[iJet].py();
+      const double            jetPz    = recoJets[iJet].pz();
+      const double            jetP     = sqrt((jetPx * jetPx) + (jetPy * jetPy) + (jetPz * jetPz));
+
+      // store jet output (constituents are appended in place)
+      output.AddJet(jetNCst, jetRecID, jetE, jetPt, jetEta, jetPhi, jetArea);
+
+      // area-subtract jet and, if possible, subtract constituents
+      vector<double> cstSubPts;
+      if (bkgd) {
+        PseudoJet jetCstSub(0., 0., 0., 0.);
+        if (bkgd -> GetConfig().doCstSub) {
+          cstSubPts = bkgd -> SubtractCsts(recoJets[iJet]);
+          for (unsigned int iCst = 0; iCst < recoCsts.size(); ++iCst) {
+
+            // zero-pt constituents (e.g. empty towers) don't contribute
+            const double cstPt    = recoCsts[iCst].perp();
+            const double cstScale = (cstPt > 0.) ? (cstSubPts[iCst] / cstPt) : 0.;
+            jetCstSub += cstScale * recoCsts[iCst];
+          }
+        }
+        const PseudoJet jetSub = bkgd -> Subtract(recoJets[iJet]);
+        output.bkgd.AddJet(jetSub.E(), jetSub.perp(), jetSub.pseudorapidity(), jetSub.phi_std(), jetCstSub.perp());
+      }
 
       // loop over constituents
-      vector<fastjet::PseudoJet> recoCsts = m_recoJets[iJet].constituents();
       for (unsigned int iCst = 0; iCst < recoCsts.size(); ++iCst) {
 
         // get constituent info
-        const double cstMatchID = recoCsts[iCst].user_index();
+        const int    cstMatchID = info.GetRecoMatchID(recoCsts[iCst].user_index());
         const double cstPhi     = recoCsts[iCst].phi_std();
         const double cstEta     = recoCsts[iCst].pseudorapidity();
         const double cstE       = recoCsts[iCst].E();
@@ -355,64 +625,55 @@ namespace SColdQcdCorrelatorAnalysis {
         const double cstDh      = cstEta - jetEta;
         const double cstDr      = sqrt((cstDf * cstDf) + (cstDh * cstDh));
 
-        // add csts to vectors
-        vecRecCstMatchID.push_back(cstMatchID);
-        vecRecCstZ.push_back(cstZ);
-        vecRecCstDr.push_back(cstDr);
-        vecRecCstE.push_back(cstE);
-        vecRecCstPt.push_back(cstPt);
-        vecRecCstEta.push_back(cstEta);
-        vecRecCstPhi.push_back(cstPhi);
+        // add csts to output
+        output.AddCst(cstMatchID, cstZ, cstDr, cstE, cstPt, cstEta, cstPhi);
+        if (!cstSubPts.empty()) {
+          output.bkgd.AddCst(cstSubPts[iCst]);
+        }
 
         // fill QA histograms and increment counters
-        m_hObjectQA[OBJECT::RCST][INFO::PT]  -> Fill(cstPt);
-        m_hObjectQA[OBJECT::RCST][INFO::ETA] -> Fill(cstEta);
-        m_hObjectQA[OBJECT::RCST][INFO::PHI] -> Fill(cstPhi);
-        m_hObjectQA[OBJECT::RCST][INFO::ENE] -> Fill(cstE);
+        if (doQA) {
+          m_hObjectQA[OBJECT::RCST][INFO::PT]  -> Fill(cstPt);
+          m_hObjectQA[OBJECT::RCST][INFO::ETA] -> Fill(cstEta);
+          m_hObjectQA[OBJECT::RCST][INFO::PHI] -> Fill(cstPhi);
+          m_hObjectQA[OBJECT::RCST][INFO::ENE] -> Fill(cstE);
+        }
         ++nRecCst;
       }  // end constituent loop
 
-      // store jet/cst output
-      m_recoJetNCst.push_back(jetNCst);
-      m_recoJetID.push_back(jetRecID);
-      m_recoJetE.push_back(jetE);
-      m_recoJetPt.push_back(jetPt);
-      m_recoJetEta.push_back(jetEta);
-      m_recoJetPhi.push_back(jetPhi);
-      m_recoJetArea.push_back(jetArea);
-      m_recoCstMatchID.push_back(vecRecCstMatchID);
-      m_recoCstZ.push_back(vecRecCstZ);
-      m_recoCstDr.push_back(vecRecCstDr);
-      m_recoCstE.push_back(vecRecCstE);
-      m_recoCstPt.push_back(vecRecCstPt);
-      m_recoCstEta.push_back(vecRecCstEta);
-      m_recoCstPhi.push_back(vecRecCstPhi);
-
       // fill QA histograms and increment counters
-      m_hJetArea[1]                        -> Fill(jetArea);
-      m_hJetNumCst[1]                      -> Fill(jetNCst);
-      m_hObjectQA[OBJECT::RJET][INFO::PT]  -> Fill(jetPt);
-      m_hObjectQA[OBJECT::RJET][INFO::ETA] -> Fill(jetEta);
-      m_hObjectQA[OBJECT::RJET][INFO::PHI] -> Fill(jetPhi);
-      m_hObjectQA[OBJECT::RJET][INFO::ENE] -> Fill(jetE);
+      if (doQA) {
+        m_hJetArea[1]                        -> Fill(jetArea);
+        m_hJetNumCst[1]                      -> Fill(jetNCst);
+        m_hObjectQA[OBJECT::RJET][INFO::PT]  -> Fill(jetPt);
+        m_hObjectQA[OBJECT::RJET][INFO::ETA] -> Fill(jetEta);
+        m_hObjectQA[OBJECT::RJET][INFO::PHI] -> Fill(jetPhi);
+        m_hObjectQA[OBJECT::RJET][INFO::ENE] -> Fill(jetE);
+      }
       ++nRecJet;
     }  // end jet loop
 
     // fill QA histograms
-    m_hNumObject[OBJECT::RJET] -> Fill(nRecJet);
-    m_hNumObject[OBJECT::RCST] -> Fill(nRecCst);
+    if (doQA) {
+      m_hNumObject[OBJECT::RJET] -> Fill(nRecJet);
+      m_hNumObject[OBJECT::RCST] -> Fill(nRecCst);
+    }
 
     // store event info
-    m_recoNumJets = nRecJet;
-    m_recoVtxX    = m_recoVtx.x();
-    m_recoVtxY    = m_recoVtx.y();
-    m_recoVtxZ    = m_recoVtx.z();
-
-    // fill object tree
-    m_recoTree -> Fill();
+    output.nJets    = nRecJet;
+    output.nTrks    = info.nTrks;
+    output.eSumECal = info.eSumECal;
+    output.eSumHCal = info.eSumHCal;
+    output.vtxX     = info.recoVtxX;
+    output.vtxY     = info.recoVtxY;
+    output.vtxZ     = info.recoVtxZ;
+    if (bkgd) {
+      output.bkgd.rho   = bkgd -> GetRho();
+      output.bkgd.sigma = bkgd -> GetSigma();
+    }
     return;
 
-  }  // end 'FillRecoTree()'
+  }  // end 'FillRecoOutput(vector<PseudoJet>&, SCorrelatorJetTreeMakerEventInfo&, SCorrelatorJetTreeMakerBkgdEstimator*, TOutput&, bool)'
 
 
 
@@ -508,11 +769,45 @@ namespace SColdQcdCorrelatorAnalysis {
     dQuality[0] -> cd();
     m_ntTrkQA   -> Write();
 
-    // save output trees
-    m_outFile  -> cd();
-    m_recoTree -> Write();
-    if (m_isMC) {
-      m_trueTree -> Write();
+    // save dca width parametrization if used
+    if (m_doDcaSigmaCut) {
+      m_fSigDcaXY -> Write();
+      m_fSigDcaZ  -> Write();
+    }
+
+    // save stage timing and counters
+    if (m_doTiming) {
+      SaveMonitor();
+    }
+
+    // save output trees, commit rntuples, and close parquet files
+    m_outFile -> cd();
+    for (size_t iCfg = 0; iCfg < m_recoTrees.size(); iCfg++) {
+      if (m_recoTrees[iCfg]) {
+        m_recoTrees[iCfg] -> Write();
+      }
+      if (m_trueTrees[iCfg]) {
+        m_trueTrees[iCfg] -> Write();
+      }
+      if (m_recoNTuples[iCfg]) {
+        m_recoNTuples[iCfg] -> Commit();
+      }
+      if (m_trueNTuples[iCfg]) {
+        m_trueNTuples[iCfg] -> Commit();
+      }
+      if (m_recoParquets[iCfg]) {
+        m_recoParquets[iCfg] -> Close();
+      }
+      if (m_trueParquets[iCfg]) {
+        m_trueParquets[iCfg] -> Close();
+      }
+    }
+    for (const vector<TTree*>& varTrees : m_varTrees) {
+      for (TTree* tree : varTrees) {
+        if (tree) {
+          tree -> Write();
+        }
+      }
     }
     return;
 
@@ -520,6 +815,46 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  void SCorrelatorJetTreeMaker::SaveMonitor() {
+
+    // print debug statement
+    if (m_doDebug) {
+      cout << "SCorrelatorJetTreeMaker::SaveMonitor() Saving stage timing and counters..." << endl;
+    }
+
+    // summarize timing and counters in histograms
+    TH1D* hStageTime  = new TH1D("hStageTime",  "Time spent per stage;;t [ms]", Monitor::STAGE::NStage, 0., Monitor::STAGE::NStage);
+    TH1D* hStageCalls = new TH1D("hStageCalls", "Calls per stage;;N_{calls}",   Monitor::STAGE::NStage, 0., Monitor::STAGE::NStage);
+    TH1D* hCounters   = new TH1D("hCounters",   "Job counters;;N",              Monitor::COUNT::NCount, 0., Monitor::COUNT::NCount);
+    for (size_t iStage = 0; iStage < Monitor::STAGE::NStage; iStage++) {
+      const Monitor::STAGE stage = static_cast<Monitor::STAGE>(iStage);
+      hStageTime  -> GetXaxis() -> SetBinLabel(iStage + 1, Monitor::GetStageName(iStage).data());
+      hStageCalls -> GetXaxis() -> SetBinLabel(iStage + 1, Monitor::GetStageName(iStage).data());
+      hStageTime  -> SetBinContent(iStage + 1, m_monitor.GetTime(stage));
+      hStageCalls -> SetBinContent(iStage + 1, m_monitor.GetCalls(stage));
+    }
+    for (size_t iCount = 0; iCount < Monitor::COUNT::NCount; iCount++) {
+      hCounters -> GetXaxis() -> SetBinLabel(iCount + 1, Monitor::GetCountName(iCount).data());
+      hCounters -> SetBinContent(iCount + 1, m_monitor.GetCount(static_cast<Monitor::COUNT>(iCount)));
+    }
+
+    // save histograms
+    TDirectory* dMonitor = (TDirectory*) m_outFile -> mkdir("Monitor");
+    dMonitor    -> cd();
+    hStageTime  -> Write();
+    hStageCalls -> Write();
+    hCounters   -> Write();
+
+    // dump to json for monitoring if needed
+    if (!m_timingJsonName.empty()) {
+      m_monitor.WriteJson(m_timingJsonName);
+    }
+    return;
+
+  }  // end 'SaveMonitor()'
+
+
+
   void SCorrelatorJetTreeMaker::ResetVariables() {
 
     // print debug statement
@@ -527,11 +862,13 @@ namespace SColdQcdCorrelatorAnalysis {
       cout << "SCorrelatorJetTreeMaker::ResetTreeVariables() Resetting tree variables..." << endl;
     }
 
-    // reset fastjet members
-    m_trueJetDef = NULL;
-    m_recoJetDef = NULL;
-    m_trueClust  = NULL;
-    m_recoClust  = NULL;
+    // reset constituent vectors and track table (capacity is kept between events)
+    m_trueCsts.clear();
+    m_recoCsts.clear();
+    m_trkTable.Reset();
+    m_recoProv.Reset();
+    m_trueProv.Reset();
+    m_nRecoTrkCsts = 0;
 
     // reset parton and other variables
     m_partonID[0]  = -9999;
@@ -539,58 +876,31 @@ namespace SColdQcdCorrelatorAnalysis {
     m_partonMom[0] = CLHEP::Hep3Vector(-9999., -9999., -9999.);
     m_partonMom[1] = CLHEP::Hep3Vector(-9999., -9999., -9999.);
     m_vecEvtsToGrab.clear();
-    m_mapCstToEmbedID.clear();
-
-    // reset truth (inclusive) tree variables
-    m_trueVtx           = CLHEP::Hep3Vector(-9999., -9999., -9999.);
-    m_trueNumJets       = 0;
-    m_trueNumChrgPars   = -9999;
-    m_trueSumPar        = -9999.;
-    m_truePartonID[0]   = -9999;
-    m_truePartonID[1]   = -9999;
-    m_truePartonMomX[0] = -9999.;
-    m_truePartonMomX[1] = -9999.;
-    m_truePartonMomY[0] = -9999.;
-    m_truePartonMomY[1] = -9999.;
-    m_truePartonMomZ[0] = -9999.;
-    m_truePartonMomZ[1] = -9999.;
-    m_trueJets.clear();
-    m_trueJetNCst.clear();
-    m_trueJetID.clear();
-    m_trueJetE.clear();
-    m_trueJetPt.clear();
-    m_trueJetEta.clear();    
-    m_trueJetPhi.clear();
-    m_trueJetArea.clear();
-    m_trueCstID.clear();
-    m_trueCstEmbedID.clear();
-    m_trueCstZ.clear();
-    m_trueCstDr.clear();
-    m_trueCstE.clear();
-    m_trueCstPt.clear();
-    m_trueCstEta.clear();
-    m_trueCstPhi.clear();
-
-    // reset reco tree variables
+
+    // reset truth (inclusive) event variables
+    m_trueVtx         = CLHEP::Hep3Vector(-9999., -9999., -9999.);
+    m_trueNumChrgPars = -9999;
+    m_trueSumPar      = -9999.;
+
+    // reset reco event variables
     m_recoVtx     = CLHEP::Hep3Vector(-9999., -9999., -9999.);
-    m_recoNumJets = 0;
     m_recoNumTrks = -9999;
     m_recoSumECal = -9999.;
     m_recoSumHCal = -9999.;
-    m_recoJets.clear();
-    m_recoJetNCst.clear();
-    m_recoJetID.clear();
-    m_recoJetE.clear();
-    m_recoJetPt.clear();
-    m_recoJetEta.clear();
-    m_recoJetPhi.clear();
-    m_recoJetArea.clear();
-    m_recoCstZ.clear();
-    m_recoCstDr.clear();
-    m_recoCstE.clear();
-    m_recoCstPt.clear();
-    m_recoCstEta.clear();
-    m_recoCstPhi.clear();
+
+    // reset tree variables
+    for (SCorrelatorJetTreeMakerLegacyTruthOutput& output : m_trueOutputs) {
+      output.Reset();
+    }
+    for (SCorrelatorJetTreeMakerLegacyRecoOutput& output : m_recoOutputs) {
+      output.Reset();
+    }
+    for (SCorrelatorJetTreeMakerFlatTruthOutput& output : m_trueFlatOutputs) {
+      output.Reset();
+    }
+    for (SCorrelatorJetTreeMakerFlatRecoOutput& output : m_recoFlatOutputs) {
+      output.Reset();
+    }
     return;
 
   }  // end 'ResetTreeVariables()
@@ -623,6 +933,45 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  void SCorrelatorJetTreeMaker::CheckMemoryUsage() {
+
+    // print debug statement
+    if (m_doDebug && (Verbosity() > 1)) {
+      cout << "SCorrelatorJetTreeMaker::CheckMemoryUsage() Checking memory usage..." << endl;
+    }
+
+    // resident memory is only reported (in End) with debugging or
+    // verbosity on, so /proc is only read then and only once, after
+    // warm-up; the final value is read in End
+    ++m_nEvtProcessed;
+    if ((m_doDebug || (Verbosity() > 0)) && (m_nEvtProcessed == CONST::NEvtWarmUp)) {
+      m_memWarmUp = GetResidentMemory();
+      m_memLast   = m_memWarmUp;
+    }
+    return;
+
+  }  // end 'CheckMemoryUsage()'
+
+
+
+  long SCorrelatorJetTreeMaker::GetResidentMemory() {
+
+    // grab resident set size (in pages) from the proc filesystem
+    long     nPages    = 0;
+    long     nResident = 0;
+    ifstream statm("/proc/self/statm");
+    if (statm.good()) {
+      statm >> nPages >> nResident;
+    }
+
+    // convert to kB
+    const long pageSize = sysconf(_SC_PAGESIZE) / 1024;
+    return nResident * pageSize;
+
+  }  // end 'GetResidentMemory()'
+
+
+
   int SCorrelatorJetTreeMaker::CreateJetNode(PHCompositeNode* topNode) {
 
     // print debug statement
@@ -0,0 +1,258 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerBackground.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERBACKGROUND_H
+#define SCORRELATORJETTREEMAKERBACKGROUND_H
+
+// c++ utilities
+#include <tuple>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <algorithm>
+// fastjet libraries
+#include <fastjet/Selector.hh>
+#include <fastjet/PseudoJet.hh>
+#include <fastjet/JetDefinition.hh>
+#include <fastjet/ClusterSequenceAreaBase.hh>
+#include <fastjet/tools/GridMedianBackgroundEstimator.hh>
+#include <fastjet/tools/JetMedianBackgroundEstimator.hh>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerClusterer.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace fastjet;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerBkgdConfig definition -----------------------------
+
+  struct SCorrelatorJetTreeMakerBkgdConfig {
+
+    // GRID takes the median pt/area over a grid of rapidity-phi cells
+    // filled directly with the constituents; AREA takes it over kt jets
+    enum TYPE {NONE = 0, GRID = 1, AREA = 2};
+
+    TYPE   type        = TYPE::NONE;
+    double maxRap      = 1.1;   // constituent acceptance
+    double gridSize    = 0.55;  // cell size for GRID
+    double rKt         = 0.4;   // kt jet radius for AREA
+    int    nHardRemove = 2;     // no. of hardest kt jets left out of AREA median
+    bool   doCstSub    = true;  // constituent-level subtraction (needs active areas)
+    double cstSubRMax  = 0.25;  // max. distance between matched ghosts and constituents
+
+  };  // end SCorrelatorJetTreeMakerBkgdConfig
+
+
+
+  // SCorrelatorJetTreeMakerBkgdEstimator definition --------------------------
+
+  // Estimates rho and sigma once per event from the reco constituents.
+  // For AREA, the kt clustering of a jet configuration is reused if it
+  // already has the right algorithm, radius, and areas; otherwise the
+  // estimator clusters with its own kt clusterer (and cached ghosts).
+
+  class SCorrelatorJetTreeMakerBkgdEstimator {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerBkgdEstimator() {};
+      ~SCorrelatorJetTreeMakerBkgdEstimator() {};
+
+      // copies get a copy of the kt clusterer's ghosts (see the
+      // clusterer) and their own fastjet estimators
+      SCorrelatorJetTreeMakerBkgdEstimator(const SCorrelatorJetTreeMakerBkgdEstimator& other) :
+        m_config(other.m_config),
+        m_ktClusterer(other.m_ktClusterer) {
+        MakeEstimators();
+      };
+
+      // getters
+      double                                   GetRho()    const {return m_rho;}
+      double                                   GetSigma()  const {return m_sigma;}
+      const SCorrelatorJetTreeMakerBkgdConfig& GetConfig() const {return m_config;}
+
+
+
+      void SetConfig(const SCorrelatorJetTreeMakerBkgdConfig& config, const SCorrelatorJetTreeMakerAreaConfig& areaConfig) {
+
+        m_config = config;
+        MakeEstimators();
+
+        // same ghost setup as the jets (grid is cached by the clusterer)
+        if (m_config.type == SCorrelatorJetTreeMakerBkgdConfig::TYPE::AREA) {
+          SCorrelatorJetTreeMakerAreaConfig ktArea = areaConfig;
+          ktArea.ghostMaxRap = m_config.maxRap;
+          if (ktArea.type == SCorrelatorJetTreeMakerAreaConfig::TYPE::NONE) {
+            ktArea.type = SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE;
+          }
+          m_ktClusterer.SetJetDefinition(JetDefinition(kt_algorithm, m_config.rKt, E_scheme, Best));
+          m_ktClusterer.SetAreaConfig(ktArea);
+        }
+        return;
+
+      }  // end 'SetConfig(SCorrelatorJetTreeMakerBkgdConfig&, SCorrelatorJetTreeMakerAreaConfig&)'
+
+
+
+      // 'ktJets' can point to a clusterer which already ran kt (with
+      // areas and radius rKt) over the same constituents, or be NULL
+      void Estimate(const vector<PseudoJet>& csts, const SCorrelatorJetTreeMakerClusterer* ktJets = NULL) {
+
+        m_rho   = 0.;
+        m_sigma = 0.;
+        switch (m_config.type) {
+
+          case SCorrelatorJetTreeMakerBkgdConfig::TYPE::GRID:
+            m_grid -> set_particles(csts);
+            m_rho   = m_grid -> rho();
+            m_sigma = m_grid -> sigma();
+            break;
+
+          case SCorrelatorJetTreeMakerBkgdConfig::TYPE::AREA:
+            {
+              if (!ktJets) {
+                m_ktClusterer.Cluster(csts);
+                ktJets = &m_ktClusterer;
+              }
+              const ClusterSequenceAreaBase* clust = dynamic_cast<const ClusterSequenceAreaBase*>(ktJets -> GetClusterSequence());
+              if (!clust || csts.empty()) break;
+
+              m_median -> set_cluster_sequence(*clust);
+              m_rho   = m_median -> rho();
+              m_sigma = m_median -> sigma();
+            }
+            break;
+
+          default:
+            break;
+        }
+        return;
+
+      }  // end 'Estimate(vector<PseudoJet>&, SCorrelatorJetTreeMakerClusterer*)'
+
+
+
+      // jet minus rho x (4-vector) area; zero if fully subtracted
+      PseudoJet Subtract(const PseudoJet& jet) const {
+
+        if (!jet.has_area()) return jet;
+
+        const PseudoJet bkgd = m_rho * jet.area_4vector();
+        if (bkgd.perp() >= jet.perp()) {
+          return PseudoJet(0., 0., 0., 0.);
+        }
+        return jet - bkgd;
+
+      }  // end 'Subtract(PseudoJet&)'
+
+
+
+      // subtracted pt of each (non-ghost) constituent, in the order of
+      // SCorrelatorJetTreeMakerClusterer::GetConstituents(jet): ghosts
+      // in the jet carry rho x (ghost area) and are matched to the
+      // closest constituents first, each pair removing the smaller pt
+      vector<double> SubtractCsts(const PseudoJet& jet) const {
+
+        // split constituents into particles and ghosts
+        const vector<PseudoJet> all = jet.constituents();
+        vector<const PseudoJet*> parts;
+        vector<const PseudoJet*> ghosts;
+        for (const PseudoJet& cst : all) {
+          if (cst.user_index() == SCorrelatorJetTreeMakerClusterer::GhostIndex) {
+            ghosts.push_back(&cst);
+          } else {
+            parts.push_back(&cst);
+          }
+        }
+
+        vector<double> partPt(parts.size());
+        for (size_t iPart = 0; iPart < parts.size(); iPart++) {
+          partPt[iPart] = parts[iPart] -> perp();
+        }
+        if (ghosts.empty() || !jet.has_area()) return partPt;
+
+        // every ghost in the jet covers the same area
+        const double   ghostPt = m_rho * (jet.area() / ghosts.size());
+        vector<double> ghostPts(ghosts.size(), ghostPt);
+
+        // all particle-ghost pairs within range, closest first
+        const double                          dr2Max = m_config.cstSubRMax * m_config.cstSubRMax;
+        vector<tuple<double, size_t, size_t>> pairs;
+        for (size_t iPart = 0; iPart < parts.size(); iPart++) {
+          for (size_t iGhost = 0; iGhost < ghosts.size(); iGhost++) {
+            const double dr2 = parts[iPart] -> squared_distance(*ghosts[iGhost]);
+            if (dr2 < dr2Max) {
+              pairs.emplace_back(dr2, iPart, iGhost);
+            }
+          }
+        }
+        sort(pairs.begin(), pairs.end());
+
+        for (const tuple<double, size_t, size_t>& pair : pairs) {
+          double& pPart  = partPt[get<1>(pair)];
+          double& pGhost = ghostPts[get<2>(pair)];
+          if ((pPart <= 0.) || (pGhost <= 0.)) continue;
+
+          const double removed = min(pPart, pGhost);
+          pPart  -= removed;
+          pGhost -= removed;
+        }
+        return partPt;
+
+      }  // end 'SubtractCsts(PseudoJet&)'
+
+    private:
+
+      void MakeEstimators() {
+
+        m_grid.reset();
+        m_median.reset();
+        switch (m_config.type) {
+
+          case SCorrelatorJetTreeMakerBkgdConfig::TYPE::GRID:
+            m_grid = make_unique<GridMedianBackgroundEstimator>(m_config.maxRap, m_config.gridSize);
+            break;
+
+          case SCorrelatorJetTreeMakerBkgdConfig::TYPE::AREA:
+            {
+              // kt jets need to be fully inside the acceptance
+              const Selector range = SelectorAbsRapMax(m_config.maxRap - m_config.rKt) * (!SelectorNHardest(m_config.nHardRemove));
+              m_median = make_unique<JetMedianBackgroundEstimator>(range);
+            }
+            break;
+
+          default:
+            break;
+        }
+        return;
+
+      }  // end 'MakeEstimators()'
+
+      // members
+      double                                    m_rho   = 0.;
+      double                                    m_sigma = 0.;
+      SCorrelatorJetTreeMakerBkgdConfig         m_config;
+      SCorrelatorJetTreeMakerClusterer          m_ktClusterer;
+      unique_ptr<GridMedianBackgroundEstimator> m_grid;
+      unique_ptr<JetMedianBackgroundEstimator>  m_median;
+
+  };  // end SCorrelatorJetTreeMakerBkgdEstimator
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,968 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerBenchmark.cc'
+// Derek Anderson
+// 10.15.2026
+//
+// A standalone benchmark for the SCorrelatorJetTreeMaker module. Generates
+// synthetic events (no Fun4All or DSTs needed) and drives the track
+// selection, clustering and tree-filling stages directly.
+//
+// Usage:
+//   benchjettreemaker [nEvt] [nTrk] [nPar] [nClust] [doFlat] [outFile] [doDcaSigmaCut]
+//   benchjettreemaker io [nEvt] [doFlat] [outFile] [doFloat]
+//   benchjettreemaker area [nEvt] [nCst] [rJet]
+//   benchjettreemaker match [nEvt] [nPar] [rJet]
+//   benchjettreemaker soak [nEvt] [maxGrowth] [outFile]
+//   benchjettreemaker batch [nEvt] [nThreads] [nCst]
+//
+// The 'io' mode writes the same reference sample under several compression,
+// basket, and cluster settings and reports file size, write and read times.
+// The 'area' mode clusters the same events with each jet-area option and
+// reports the added per-event cost. The 'match' mode compares truth-reco
+// jet matching in the module against brute-force loops over jet and
+// constituent pairs. The 'soak' mode runs the default benchmark over many
+// events (1M by default) and fails (returns 1) if the resident memory
+// grows by more than maxGrowth kB after warm-up. The 'batch' mode clusters
+// (with active areas) and estimates the background for the same events
+// serially and on several threads, the way batch-mode workers do, and
+// fails (returns 1) unless every jet pt, area, and rho is bit-identical.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+// c++ utilities
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <utility>
+#include <iostream>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <unistd.h>
+// root libraries
+#include <TFile.h>
+#include <TTree.h>
+// fastjet libraries
+#include <fastjet/PseudoJet.hh>
+#include <fastjet/JetDefinition.hh>
+#include <fastjet/AreaDefinition.hh>
+#include <fastjet/ClusterSequenceArea.hh>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerOutput.h"
+#include "SCorrelatorJetTreeMakerMatcher.h"
+#include "SCorrelatorJetTreeMakerMonitor.h"
+#include "SCorrelatorJetTreeMakerClusterer.h"
+#include "SCorrelatorJetTreeMakerBackground.h"
+#include "SCorrelatorJetTreeMakerTrackTable.h"
+#include "SCorrelatorJetTreeMakerTrackSelector.h"
+#include "SCorrelatorJetTreeMakerWriteConfig.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace fastjet;
+using namespace SColdQcdCorrelatorAnalysis;
+
+
+
+// allocation counting --------------------------------------------------------
+
+namespace {
+
+  atomic<uint64_t> nAllocs(0);
+
+}  // end anonymous namespace
+
+void* operator new(size_t size) {
+  ++nAllocs;
+  void* ptr = malloc(size == 0 ? 1 : size);
+  if (!ptr) throw bad_alloc();
+  return ptr;
+}
+
+// kept out of line so that gcc doesn't pair an inlined free()
+// with operator new (-Wmismatched-new-delete)
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+
+
+// benchmark definition -------------------------------------------------------
+
+namespace {
+
+  // benchmark options
+  struct BenchmarkConfig {
+    size_t nEvt      = 1000;
+    size_t nWarmUp   = 100;
+    long   maxGrowth = -1;
+    double nTrk    = 500.;
+    double nPar    = 600.;
+    double nClust  = 200.;
+    double rJet    = 0.4;
+    bool   doFlat  = false;
+    bool   doSigma = false;
+    bool   doFloat = false;
+    string outFile = "benchmark.root";
+  };
+
+
+
+  long GetResidentMemory() {
+
+    // current resident set size in kB
+    long nPages(0);
+    long nResident(0);
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (statm) {
+      if (fscanf(statm, "%ld %ld", &nPages, &nResident) != 2) {
+        nResident = 0;
+      }
+      fclose(statm);
+    }
+    return nResident * (sysconf(_SC_PAGESIZE) / 1024);
+
+  }  // end 'GetResidentMemory()'
+
+
+
+  long GetPeakMemory() {
+
+    // peak resident set size in kB
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+
+  }  // end 'GetPeakMemory()'
+
+
+
+  double GenerateMomentum(mt19937_64& rng) {
+
+    // power-law pt spectrum above 0.2 GeV/c
+    uniform_real_distribution<double> flat(0., 1.);
+    return 0.2 * pow(1. - flat(rng), -1. / 5.);
+
+  }  // end 'GenerateMomentum(mt19937_64&)'
+
+
+
+  void GenerateTracks(mt19937_64& rng, const double nMean, SCorrelatorJetTreeMakerTrackTable& table) {
+
+    poisson_distribution<int>         mult(nMean);
+    poisson_distribution<int>         hits(45.);
+    uniform_real_distribution<double> eta(-1.2, 1.2);
+    uniform_real_distribution<double> phi(-M_PI, M_PI);
+    uniform_real_distribution<double> qual(0., 12.);
+    normal_distribution<double>       dca(0., 0.1);
+    normal_distribution<double>       vtx(0., 0.05);
+    normal_distribution<double>       vtxZ(0., 5.);
+    uniform_real_distribution<double> flat(0., 1.);
+
+    // mimic the maker: one row per track
+    const int    nTrk  = mult(rng);
+    const double vz    = vtxZ(rng);
+    for (int iTrk = 0; iTrk < nTrk; iTrk++) {
+      const size_t iRow  = table.AddRow();
+      const double pt    = GenerateMomentum(rng);
+      const double h     = eta(rng);
+      const double f     = phi(rng);
+      const double pz    = pt * sinh(h);
+      table.pt[iRow]            = pt;
+      table.eta[iRow]           = h;
+      table.phi[iRow]           = f;
+      table.px[iRow]            = pt * cos(f);
+      table.py[iRow]            = pt * sin(f);
+      table.pz[iRow]            = pz;
+      table.ene[iRow]           = sqrt((pt * pt) + (pz * pz) + (0.140 * 0.140));
+      table.quality[iRow]       = qual(rng);
+      table.dcaXY[iRow]         = dca(rng);
+      table.dcaZ[iRow]          = dca(rng);
+      table.deltaPt[iRow]       = 0.3 * flat(rng);
+      table.nMvtx[iRow]         = 1 + (int) (4. * flat(rng));
+      table.nIntt[iRow]         = (int) (3. * flat(rng));
+      table.nTpc[iRow]          = hits(rng);
+      table.hasSiSeed[iRow]     = (flat(rng) > 0.02);
+      table.hasTpcSeed[iRow]    = (flat(rng) > 0.01);
+      table.isFromPrimVtx[iRow] = (flat(rng) > 0.05);
+      table.vtxID[iRow]         = 0;
+      table.vtxX[iRow]          = vtx(rng);
+      table.vtxY[iRow]          = vtx(rng);
+      table.vtxZ[iRow]          = vz;
+      table.trkID[iRow]         = iTrk;
+      table.matchID[iRow]       = iTrk;
+    }
+    return;
+
+  }  // end 'GenerateTracks(mt19937_64&, double, SCorrelatorJetTreeMakerTrackTable&)'
+
+
+
+  void GenerateNeutrals(mt19937_64& rng, const double nMean, const int idOffset, vector<PseudoJet>& csts) {
+
+    // calorimeter clusters and truth particles are massless four-vectors
+    poisson_distribution<int>         mult(nMean);
+    uniform_real_distribution<double> eta(-1.1, 1.1);
+    uniform_real_distribution<double> phi(-M_PI, M_PI);
+
+    const int nObj = mult(rng);
+    for (int iObj = 0; iObj < nObj; iObj++) {
+      const double pt = GenerateMomentum(rng);
+      const double h  = eta(rng);
+      const double f  = phi(rng);
+      PseudoJet obj(pt * cos(f), pt * sin(f), pt * sinh(h), pt * cosh(h));
+      obj.set_user_index(idOffset + iObj);
+      csts.push_back(obj);
+    }
+    return;
+
+  }  // end 'GenerateNeutrals(mt19937_64&, double, int, vector<PseudoJet>&)'
+
+
+
+  template <typename TOutput> void FillRecoOutput(const vector<PseudoJet>& jets, TOutput& output) {
+
+    // mirrors SCorrelatorJetTreeMaker::FillRecoOutput without the QA
+    output.Reset();
+    for (unsigned int iJet = 0; iJet < jets.size(); ++iJet) {
+
+      const vector<PseudoJet> csts   = SCorrelatorJetTreeMakerClusterer::GetConstituents(jets[iJet]);
+      const double            jetPhi = jets[iJet].phi_std();
+      const double            jetEta = jets[iJet].pseudorapidity();
+      const double            jetP   = sqrt(jets[iJet].modp2());
+      output.AddJet(csts.size(), iJet, jets[iJet].E(), jets[iJet].perp(), jetEta, jetPhi, SCorrelatorJetTreeMakerClusterer::GetArea(jets[iJet]));
+
+      for (const PseudoJet& cst : csts) {
+        const double cstPhi = cst.phi_std();
+        const double cstEta = cst.pseudorapidity();
+        const double cstDf  = cstPhi - jetPhi;
+        const double cstDh  = cstEta - jetEta;
+        const double cstDr  = sqrt((cstDf * cstDf) + (cstDh * cstDh));
+        output.AddCst(cst.user_index(), cst.modp2() / jetP, cstDr, cst.E(), cst.perp(), cstEta, cstPhi);
+      }
+    }
+    output.nJets = jets.size();
+    return;
+
+  }  // end 'FillRecoOutput(vector<PseudoJet>&, TOutput&)'
+
+
+
+  template <typename TOutput> void FillTrueOutput(const vector<PseudoJet>& jets, TOutput& output) {
+
+    // mirrors SCorrelatorJetTreeMaker::FillTrueOutput without the QA
+    output.Reset();
+    for (unsigned int iJet = 0; iJet < jets.size(); ++iJet) {
+
+      const vector<PseudoJet> csts   = SCorrelatorJetTreeMakerClusterer::GetConstituents(jets[iJet]);
+      const double            jetPhi = jets[iJet].phi_std();
+      const double            jetEta = jets[iJet].pseudorapidity();
+      const double            jetP   = sqrt(jets[iJet].modp2());
+      output.AddJet(csts.size(), iJet, jets[iJet].E(), jets[iJet].perp(), jetEta, jetPhi, SCorrelatorJetTreeMakerClusterer::GetArea(jets[iJet]));
+
+      for (const PseudoJet& cst : csts) {
+        const double cstPhi = cst.phi_std();
+        const double cstEta = cst.pseudorapidity();
+        const double cstDf  = cstPhi - jetPhi;
+        const double cstDh  = cstEta - jetEta;
+        const double cstDr  = sqrt((cstDf * cstDf) + (cstDh * cstDh));
+        output.AddCst(cst.user_index(), 0, cst.modp2() / jetP, cstDr, cst.E(), cst.perp(), cstEta, cstPhi);
+      }
+    }
+    output.nJets = jets.size();
+    return;
+
+  }  // end 'FillTrueOutput(vector<PseudoJet>&, TOutput&)'
+
+
+
+  double GetFileSize(const string& fileName) {
+
+    // size on disk in MB
+    struct stat info;
+    if (stat(fileName.data(), &info) != 0) return 0.;
+    return info.st_size / (1024. * 1024.);
+
+  }  // end 'GetFileSize(string&)'
+
+
+
+  double ReadBack(const string& fileName) {
+
+    // read (and decompress) every branch of every entry,
+    // which is what the downstream analysis does
+    const auto tStart = chrono::steady_clock::now();
+    TFile*     file   = TFile::Open(fileName.data(), "read");
+    if (!file) return 0.;
+
+    for (const string treeName : {"RecoJetTree", "TruthJetTree"}) {
+      TTree* tree = (TTree*) file -> Get(treeName.data());
+      if (!tree) continue;
+      for (long long iEntry = 0; iEntry < tree -> GetEntries(); iEntry++) {
+        tree -> GetEntry(iEntry);
+      }
+    }
+    file -> Close();
+    delete file;
+
+    const chrono::duration<double> tRead = chrono::steady_clock::now() - tStart;
+    return tRead.count();
+
+  }  // end 'ReadBack(string&)'
+
+
+
+  SCorrelatorJetTreeMakerWriteConfig MakeWriteConfig(const SCorrelatorJetTreeMakerWriteConfig::COMP algo, const int level, const int basketSize = 0, const long long autoFlush = 0) {
+
+    SCorrelatorJetTreeMakerWriteConfig config;
+    config.compAlgo   = algo;
+    config.compLevel  = level;
+    config.basketSize = basketSize;
+    config.autoFlush  = autoFlush;
+    return config;
+
+  }  // end 'MakeWriteConfig(SCorrelatorJetTreeMakerWriteConfig::COMP, int, int, long long)'
+
+
+
+  template <typename TRecoOutput, typename TTrueOutput> void RunWriteBenchmark(const BenchmarkConfig& cfg) {
+
+    // settings under test: ROOT default, each algorithm at its
+    // usual level, plus bigger baskets and smaller clusters
+    typedef SCorrelatorJetTreeMakerWriteConfig WriteConfig;
+    const vector<WriteConfig> settings = {
+      MakeWriteConfig(WriteConfig::COMP::DEFAULT, 0),
+      MakeWriteConfig(WriteConfig::COMP::ZLIB,    1),
+      MakeWriteConfig(WriteConfig::COMP::LZ4,     4),
+      MakeWriteConfig(WriteConfig::COMP::ZSTD,    5),
+      MakeWriteConfig(WriteConfig::COMP::LZMA,    7),
+      MakeWriteConfig(WriteConfig::COMP::ZSTD,    5, 256000),
+      MakeWriteConfig(WriteConfig::COMP::ZSTD,    5, 256000, 1000)
+    };
+
+    // default precision: plain floats
+    const SCorrelatorJetTreeMakerPrecision precision;
+
+    // build reference sample once so every setting writes the same bytes
+    mt19937_64                       rng(12345);
+    vector<PseudoJet>                recoCsts;
+    vector<PseudoJet>                trueCsts;
+    vector<TRecoOutput>              recoSample(cfg.nEvt);
+    vector<TTrueOutput>              trueSample(cfg.nEvt);
+    SCorrelatorJetTreeMakerClusterer recoClusterer(JetDefinition(antikt_algorithm, cfg.rJet, pt_scheme, Best));
+    SCorrelatorJetTreeMakerClusterer trueClusterer(JetDefinition(antikt_algorithm, cfg.rJet, pt_scheme, Best));
+    for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+      recoCsts.clear();
+      trueCsts.clear();
+      GenerateNeutrals(rng, cfg.nTrk + cfg.nClust, 0, recoCsts);
+      GenerateNeutrals(rng, cfg.nPar, 0, trueCsts);
+      recoClusterer.Cluster(recoCsts);
+      trueClusterer.Cluster(trueCsts);
+      FillRecoOutput(recoClusterer.GetJets(), recoSample[iEvt]);
+      FillTrueOutput(trueClusterer.GetJets(), trueSample[iEvt]);
+    }
+
+    cout << "  Write settings (" << cfg.nEvt << " reference events):" << endl;
+    for (const WriteConfig& setting : settings) {
+
+      // write sample
+      const auto  tStart = chrono::steady_clock::now();
+      TFile*      file   = new TFile(cfg.outFile.data(), "recreate");
+      TTree*      reco   = new TTree("RecoJetTree",  "A tree of reconstructed jets");
+      TTree*      truth  = new TTree("TruthJetTree", "A tree of truth jets");
+      TRecoOutput recoOutput;
+      TTrueOutput trueOutput;
+      setting.Apply(file);
+      recoOutput.SetTreeAddresses(reco,  cfg.doFloat);
+      trueOutput.SetTreeAddresses(truth, cfg.doFloat);
+      setting.Apply(reco);
+      setting.Apply(truth);
+
+      double nBytes = 0.;
+      for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+        recoOutput = recoSample[iEvt];
+        trueOutput = trueSample[iEvt];
+        if (cfg.doFloat) {
+          recoOutput.Reduce(precision);
+          trueOutput.Reduce(precision);
+        }
+        nBytes    += max(reco  -> Fill(), 0);
+        nBytes    += max(truth -> Fill(), 0);
+      }
+      file  -> cd();
+      reco  -> Write();
+      truth -> Write();
+      file  -> Close();
+      delete file;
+      const chrono::duration<double> tWrite = chrono::steady_clock::now() - tStart;
+
+      // measure size and read back
+      const double size  = GetFileSize(cfg.outFile);
+      const double tRead = ReadBack(cfg.outFile);
+      cout << "    " << setting.MakeTag() << ":\n"
+           << "      size [MB] = " << size << " (ratio = " << ((size > 0.) ? (nBytes / (1024. * 1024.)) / size : 0.) << ")"
+           << ", write [s] = " << tWrite.count()
+           << ", read [s] = " << tRead
+           << endl;
+    }
+    return;
+
+  }  // end 'RunWriteBenchmark(BenchmarkConfig&)'
+
+
+
+  void RunAreaBenchmark(const BenchmarkConfig& cfg) {
+
+    // generate events up front so only clustering is timed
+    mt19937_64                rng(12345);
+    vector<vector<PseudoJet>> events(cfg.nEvt);
+    for (vector<PseudoJet>& csts : events) {
+      GenerateNeutrals(rng, cfg.nTrk, 0, csts);
+    }
+
+    // ghosts cover the constituent acceptance plus a jet radius
+    typedef SCorrelatorJetTreeMakerAreaConfig AreaConfig;
+    AreaConfig active;
+    active.type        = AreaConfig::TYPE::ACTIVE;
+    active.ghostMaxRap = 1.1 + cfg.rJet;
+
+    AreaConfig voronoi;
+    voronoi.type = AreaConfig::TYPE::VORONOI;
+
+    const JetDefinition jetDef(antikt_algorithm, cfg.rJet, pt_scheme, Best);
+    const vector<pair<string, AreaConfig>> options = {
+      {"none",                        AreaConfig()},
+      {"active (cached ghost grid)",  active},
+      {"voronoi",                     voronoi}
+    };
+
+    cout << "  Jet area options (" << cfg.nEvt << " events):" << endl;
+    double tNone = 0.;
+    for (const pair<string, AreaConfig>& option : options) {
+
+      // ghost grid is built here, outside the timed loop
+      SCorrelatorJetTreeMakerClusterer clusterer(jetDef);
+      clusterer.SetAreaConfig(option.second);
+
+      size_t     nJets   = 0;
+      double     sumArea = 0.;
+      const auto tStart  = chrono::steady_clock::now();
+      for (const vector<PseudoJet>& csts : events) {
+        for (const PseudoJet& jet : clusterer.Cluster(csts)) {
+          sumArea += SCorrelatorJetTreeMakerClusterer::GetArea(jet);
+          ++nJets;
+        }
+      }
+      const chrono::duration<double, milli> tClust = chrono::steady_clock::now() - tStart;
+      const double tPerEvt = tClust.count() / max(cfg.nEvt, (size_t) 1);
+      if (option.second.type == AreaConfig::TYPE::NONE) tNone = tPerEvt;
+
+      cout << "    " << option.first << ":\n"
+           << "      time/evt [ms] = " << tPerEvt << " (added = " << tPerEvt - tNone << ")"
+           << ", <area> = " << ((nJets > 0) ? sumArea / nJets : 0.)
+           << ", nGhosts = " << clusterer.GetNGhosts()
+           << endl;
+    }
+
+    // for reference: ghosts regenerated for every event
+    const AreaDefinition perEvtDef(active_area_explicit_ghosts, GhostedAreaSpec(active.ghostMaxRap, 1, active.ghostArea));
+    const auto           tStart = chrono::steady_clock::now();
+    for (const vector<PseudoJet>& csts : events) {
+      ClusterSequenceArea clust(csts, jetDef, perEvtDef);
+      const vector<PseudoJet> jets = clust.inclusive_jets();
+    }
+    const chrono::duration<double, milli> tClust = chrono::steady_clock::now() - tStart;
+    const double tPerEvt = tClust.count() / max(cfg.nEvt, (size_t) 1);
+    cout << "    active (ghosts per event):\n"
+         << "      time/evt [ms] = " << tPerEvt << " (added = " << tPerEvt - tNone << ")"
+         << endl;
+    return;
+
+  }  // end 'RunAreaBenchmark(BenchmarkConfig&)'
+
+
+
+  void MatchBruteForce(const vector<PseudoJet>& recoJets, const vector<PseudoJet>& trueJets, const double maxDr, vector<int>& jetIDs, vector<int>& cstJetIDs) {
+
+    // what offline analyses do: every jet pair, every constituent pair
+    jetIDs.assign(recoJets.size(), -1);
+    cstJetIDs.assign(recoJets.size(), -1);
+    for (size_t iReco = 0; iReco < recoJets.size(); iReco++) {
+      const vector<PseudoJet> recoCsts = SCorrelatorJetTreeMakerClusterer::GetConstituents(recoJets[iReco]);
+
+      double drMin     = maxDr;
+      double sharedMax = 0.;
+      for (size_t iTrue = 0; iTrue < trueJets.size(); iTrue++) {
+        const double dEta = recoJets[iReco].pseudorapidity() - trueJets[iTrue].pseudorapidity();
+        const double dPhi = remainder(recoJets[iReco].phi_std() - trueJets[iTrue].phi_std(), 2. * M_PI);
+        const double dr   = sqrt((dEta * dEta) + (dPhi * dPhi));
+        if (dr <= drMin) {
+          drMin         = dr;
+          jetIDs[iReco] = iTrue;
+        }
+
+        double shared = 0.;
+        for (const PseudoJet& trueCst : SCorrelatorJetTreeMakerClusterer::GetConstituents(trueJets[iTrue])) {
+          for (const PseudoJet& recoCst : recoCsts) {
+            if (recoCst.user_index() == trueCst.user_index()) shared += recoCst.E();
+          }
+        }
+        if (shared > sharedMax) {
+          sharedMax        = shared;
+          cstJetIDs[iReco] = iTrue;
+        }
+      }
+    }
+    return;
+
+  }  // end 'MatchBruteForce(vector<PseudoJet>&, vector<PseudoJet>&, double, vector<int>&, vector<int>&)'
+
+
+
+  void RunMatchBenchmark(const BenchmarkConfig& cfg) {
+
+    // truth particles, and reco tracks smeared from 90% of them
+    // which carry the particle barcode as user index
+    mt19937_64                        rng(12345);
+    uniform_real_distribution<double> flat(0., 1.);
+    normal_distribution<double>       smear(0., 0.02);
+
+    const JetDefinition              jetDef(antikt_algorithm, cfg.rJet, pt_scheme, Best);
+    SCorrelatorJetTreeMakerClusterer recoClusterer(jetDef);
+    SCorrelatorJetTreeMakerClusterer trueClusterer(jetDef);
+
+    SCorrelatorJetTreeMakerMatchConfig matchConfig;
+    matchConfig.doMatch = true;
+    matchConfig.maxDr   = cfg.rJet;
+
+    SCorrelatorJetTreeMakerJetMatcher matcher;
+    matcher.SetConfig(matchConfig);
+
+    // only matching is timed
+    double            tBrute   = 0.;
+    double            tMatcher = 0.;
+    size_t            nJets    = 0;
+    size_t            nAgree   = 0;
+    vector<int>       jetIDs;
+    vector<int>       cstJetIDs;
+    vector<PseudoJet> trueCsts;
+    vector<PseudoJet> recoCsts;
+    vector<int>       barcodes;
+    for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+
+      trueCsts.clear();
+      recoCsts.clear();
+      GenerateNeutrals(rng, cfg.nPar, 0, trueCsts);
+
+      // user indices are the particles' positions, which double as barcodes
+      barcodes.resize(trueCsts.size());
+      iota(barcodes.begin(), barcodes.end(), 0);
+      for (const PseudoJet& par : trueCsts) {
+        if (flat(rng) > 0.9) continue;
+        const double pt  = par.perp() * (1. + smear(rng));
+        const double eta = par.pseudorapidity() + smear(rng);
+        const double phi = par.phi_std() + smear(rng);
+        PseudoJet trk(pt * cos(phi), pt * sin(phi), pt * sinh(eta), pt * cosh(eta));
+        trk.set_user_index(par.user_index());
+        recoCsts.push_back(trk);
+      }
+      const vector<PseudoJet>& recoJets = recoClusterer.Cluster(recoCsts);
+      const vector<PseudoJet>& trueJets = trueClusterer.Cluster(trueCsts);
+
+      const auto tBruteStart = chrono::steady_clock::now();
+      MatchBruteForce(recoJets, trueJets, matchConfig.maxDr, jetIDs, cstJetIDs);
+      const chrono::duration<double, milli> tBruteEvt = chrono::steady_clock::now() - tBruteStart;
+
+      const auto tMatchStart = chrono::steady_clock::now();
+      matcher.Match(recoJets, trueJets, barcodes, barcodes);
+      const chrono::duration<double, milli> tMatchEvt = chrono::steady_clock::now() - tMatchStart;
+
+      tBrute   += tBruteEvt.count();
+      tMatcher += tMatchEvt.count();
+      for (size_t iReco = 0; iReco < recoJets.size(); iReco++) {
+        const SCorrelatorJetTreeMakerJetMatch& match = matcher.GetRecoMatches()[iReco];
+        if ((match.jetID == jetIDs[iReco]) && (match.cstJetID == cstJetIDs[iReco])) ++nAgree;
+      }
+      nJets += recoJets.size();
+    }
+
+    const double nEvt = max((double) cfg.nEvt, 1.);
+    cout << "  Truth-reco jet matching (" << cfg.nEvt << " events, " << nJets / nEvt << " reco jets/event):\n"
+         << "    brute force:   time/evt [ms] = " << tBrute / nEvt << "\n"
+         << "    grid + hash:   time/evt [ms] = " << tMatcher / nEvt << " (speed-up = " << ((tMatcher > 0.) ? tBrute / tMatcher : 0.) << ")\n"
+         << "    same matches for " << nAgree << "/" << nJets << " reco jets"
+         << endl;
+    return;
+
+  }  // end 'RunMatchBenchmark(BenchmarkConfig&)'
+
+
+
+  void DigestEvent(SCorrelatorJetTreeMakerClusterer& clusterer, SCorrelatorJetTreeMakerBkgdEstimator& estimator, const vector<PseudoJet>& csts, vector<double>& digest) {
+
+    // everything in the output which depends on the ghosts
+    digest.clear();
+    const vector<PseudoJet>& jets = clusterer.Cluster(csts);
+    estimator.Estimate(csts);
+    digest.push_back(estimator.GetRho());
+    digest.push_back(estimator.GetSigma());
+    for (const PseudoJet& jet : jets) {
+      digest.push_back(jet.perp());
+      digest.push_back(SCorrelatorJetTreeMakerClusterer::GetArea(jet));
+      digest.push_back(estimator.Subtract(jet).perp());
+      for (const double cstSubPt : estimator.SubtractCsts(jet)) {
+        digest.push_back(cstSubPt);
+      }
+    }
+    return;
+
+  }  // end 'DigestEvent(SCorrelatorJetTreeMakerClusterer&, SCorrelatorJetTreeMakerBkgdEstimator&, vector<PseudoJet>&, vector<double>&)'
+
+
+
+  bool RunBatchCheck(const BenchmarkConfig& cfg, const size_t nThreads) {
+
+    // generate events up front
+    mt19937_64                rng(12345);
+    vector<vector<PseudoJet>> events(cfg.nEvt);
+    for (vector<PseudoJet>& csts : events) {
+      GenerateNeutrals(rng, cfg.nTrk, 0, csts);
+    }
+
+    // job-wide finders, built once on this thread as in
+    // InitJetFinders and InitBkgd
+    SCorrelatorJetTreeMakerAreaConfig areaConfig;
+    areaConfig.type        = SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE;
+    areaConfig.ghostMaxRap = 1.1 + cfg.rJet;
+
+    SCorrelatorJetTreeMakerBkgdConfig bkgdConfig;
+    bkgdConfig.type   = SCorrelatorJetTreeMakerBkgdConfig::TYPE::AREA;
+    bkgdConfig.maxRap = 1.1;
+
+    SCorrelatorJetTreeMakerClusterer clusterer(JetDefinition(antikt_algorithm, cfg.rJet, pt_scheme, Best));
+    clusterer.SetAreaConfig(areaConfig);
+
+    SCorrelatorJetTreeMakerBkgdEstimator estimator;
+    estimator.SetConfig(bkgdConfig, areaConfig);
+
+    // serial reference
+    vector<vector<double>> serial(cfg.nEvt);
+    for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+      DigestEvent(clusterer, estimator, events[iEvt], serial[iEvt]);
+    }
+
+    // workers copy the finders, as in RunBatchWorker
+    vector<vector<double>> batch(cfg.nEvt);
+    vector<thread>         workers;
+    for (size_t iThread = 0; iThread < nThreads; iThread++) {
+      workers.emplace_back([&, iThread]() {
+        SCorrelatorJetTreeMakerClusterer     workClusterer(clusterer);
+        SCorrelatorJetTreeMakerBkgdEstimator workEstimator(estimator);
+        for (size_t iEvt = iThread; iEvt < cfg.nEvt; iEvt += nThreads) {
+          DigestEvent(workClusterer, workEstimator, events[iEvt], batch[iEvt]);
+        }
+      });
+    }
+    for (thread& worker : workers) {
+      worker.join();
+    }
+
+    // compare bit-for-bit
+    size_t nValues = 0;
+    size_t nDiffer = 0;
+    for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+      if (serial[iEvt].size() != batch[iEvt].size()) {
+        ++nDiffer;
+        continue;
+      }
+      for (size_t iVal = 0; iVal < serial[iEvt].size(); iVal++) {
+        if (serial[iEvt][iVal] != batch[iEvt][iVal]) ++nDiffer;
+      }
+      nValues += serial[iEvt].size();
+    }
+
+    cout << "  Batch vs. serial (" << cfg.nEvt << " events, " << nThreads << " threads, " << clusterer.GetNGhosts() << " ghosts):\n"
+         << "    " << nValues << " values compared, " << nDiffer << " differ"
+         << endl;
+    return (nDiffer == 0);
+
+  }  // end 'RunBatchCheck(BenchmarkConfig&, size_t)'
+
+}  // end anonymous namespace
+
+
+
+// benchmark ------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+
+  // write-settings mode
+  BenchmarkConfig cfg;
+  if ((argc > 1) && (string(argv[1]) == "io")) {
+    if (argc > 2) cfg.nEvt    = strtoul(argv[2], NULL, 10);
+    if (argc > 3) cfg.doFlat  = (atoi(argv[3]) != 0);
+    if (argc > 4) cfg.outFile = argv[4];
+    if (argc > 5) cfg.doFloat = (atoi(argv[5]) != 0);
+
+    cout << "\n  Running SCorrelatorJetTreeMaker write benchmark:\n"
+         << "    nEvt = " << cfg.nEvt << ", flat output = " << cfg.doFlat << ", float output = " << cfg.doFloat << "\n"
+         << endl;
+    if (cfg.doFlat) {
+      RunWriteBenchmark<SCorrelatorJetTreeMakerFlatRecoOutput, SCorrelatorJetTreeMakerFlatTruthOutput>(cfg);
+    } else {
+      RunWriteBenchmark<SCorrelatorJetTreeMakerLegacyRecoOutput, SCorrelatorJetTreeMakerLegacyTruthOutput>(cfg);
+    }
+    cout << "\n  Benchmark finished!\n" << endl;
+    return 0;
+  }
+
+  // jet-area mode
+  if ((argc > 1) && (string(argv[1]) == "area")) {
+    if (argc > 2) cfg.nEvt = strtoul(argv[2], NULL, 10);
+    if (argc > 3) cfg.nTrk = atof(argv[3]);
+    if (argc > 4) cfg.rJet = atof(argv[4]);
+
+    cout << "\n  Running SCorrelatorJetTreeMaker jet area benchmark:\n"
+         << "    nEvt = " << cfg.nEvt << ", <nCst> = " << cfg.nTrk << ", R = " << cfg.rJet << "\n"
+         << endl;
+    RunAreaBenchmark(cfg);
+    cout << "\n  Benchmark finished!\n" << endl;
+    return 0;
+  }
+
+  // jet-matching mode
+  if ((argc > 1) && (string(argv[1]) == "match")) {
+    if (argc > 2) cfg.nEvt = strtoul(argv[2], NULL, 10);
+    if (argc > 3) cfg.nPar = atof(argv[3]);
+    if (argc > 4) cfg.rJet = atof(argv[4]);
+
+    cout << "\n  Running SCorrelatorJetTreeMaker jet matching benchmark:\n"
+         << "    nEvt = " << cfg.nEvt << ", <nPar> = " << cfg.nPar << ", R = " << cfg.rJet << "\n"
+         << endl;
+    RunMatchBenchmark(cfg);
+    cout << "\n  Benchmark finished!\n" << endl;
+    return 0;
+  }
+
+  // batch-vs-serial reproducibility mode
+  if ((argc > 1) && (string(argv[1]) == "batch")) {
+    size_t nThreads = 4;
+    cfg.nEvt = 200;
+    cfg.nTrk = 300.;
+    if (argc > 2) cfg.nEvt   = strtoul(argv[2], NULL, 10);
+    if (argc > 3) nThreads   = max((size_t) 1, (size_t) strtoul(argv[3], NULL, 10));
+    if (argc > 4) cfg.nTrk   = atof(argv[4]);
+
+    cout << "\n  Running SCorrelatorJetTreeMaker batch reproducibility check:\n"
+         << "    nEvt = " << cfg.nEvt << ", nThreads = " << nThreads << ", <nCst> = " << cfg.nTrk << "\n"
+         << endl;
+    const bool isSame = RunBatchCheck(cfg, nThreads);
+    if (!isSame) {
+      cerr << "\n  FAILED: batch output differs from serial output!\n" << endl;
+      return 1;
+    }
+    cout << "\n  Benchmark finished!\n" << endl;
+    return 0;
+  }
+
+  // long-run memory mode: same loop, but with a pass/fail memory check
+  if ((argc > 1) && (string(argv[1]) == "soak")) {
+    cfg.nEvt      = 1000000;
+    cfg.maxGrowth = 10240;
+    cfg.outFile   = "benchmark_soak.root";
+    if (argc > 2) cfg.nEvt      = strtoul(argv[2], NULL, 10);
+    if (argc > 3) cfg.maxGrowth = atol(argv[3]);
+    if (argc > 4) cfg.outFile   = argv[4];
+    cfg.nWarmUp = min((size_t) 10000, cfg.nEvt / 10);
+  } else {
+    if (argc > 1) cfg.nEvt    = strtoul(argv[1], NULL, 10);
+    if (argc > 2) cfg.nTrk    = atof(argv[2]);
+    if (argc > 3) cfg.nPar    = atof(argv[3]);
+    if (argc > 4) cfg.nClust  = atof(argv[4]);
+    if (argc > 5) cfg.doFlat  = (atoi(argv[5]) != 0);
+    if (argc > 6) cfg.outFile = argv[6];
+    if (argc > 7) cfg.doSigma = (atoi(argv[7]) != 0);
+    cfg.nWarmUp = min(cfg.nWarmUp, cfg.nEvt / 10);
+  }
+
+  cout << "\n  Running SCorrelatorJetTreeMaker benchmark:\n"
+       << "    nEvt = " << cfg.nEvt << ", <nTrk> = " << cfg.nTrk << ", <nPar> = " << cfg.nPar
+       << ", <nClust> = " << cfg.nClust << ", flat output = " << cfg.doFlat << ", dca sigma cut = " << cfg.doSigma << "\n"
+       << endl;
+
+  // stages under test
+  SCorrelatorJetTreeMakerTrackTable    table;
+  SCorrelatorJetTreeMakerTrackCuts     cuts;
+  cuts.doDcaSigmaCut = cfg.doSigma;
+  cuts.sigDcaXY.par  = {0.02, 0.03, 0.01};
+  cuts.sigDcaZ.par   = {0.02, 0.04, 0.01};
+  cuts.nSigCutXY     = 3.;
+  cuts.nSigCutZ      = 3.;
+
+  SCorrelatorJetTreeMakerTrackSelector selector(cuts);
+  SCorrelatorJetTreeMakerClusterer     recoClusterer(JetDefinition(antikt_algorithm, cfg.rJet, pt_scheme, Best));
+  SCorrelatorJetTreeMakerClusterer     trueClusterer(JetDefinition(antikt_algorithm, cfg.rJet, pt_scheme, Best));
+  SCorrelatorJetTreeMakerMonitor       monitor;
+  monitor.SetEnabled(true);
+
+  // output
+  SCorrelatorJetTreeMakerLegacyRecoOutput  recoLegacy;
+  SCorrelatorJetTreeMakerLegacyTruthOutput trueLegacy;
+  SCorrelatorJetTreeMakerFlatRecoOutput    recoFlat;
+  SCorrelatorJetTreeMakerFlatTruthOutput   trueFlat;
+
+  TFile* file     = new TFile(cfg.outFile.data(), "recreate");
+  TTree* recoTree = new TTree("RecoJetTree",  "A tree of reconstructed jets");
+  TTree* trueTree = new TTree("TruthJetTree", "A tree of truth jets");
+  if (cfg.doFlat) {
+    recoFlat.SetTreeAddresses(recoTree);
+    trueFlat.SetTreeAddresses(trueTree);
+  } else {
+    recoLegacy.SetTreeAddresses(recoTree);
+    trueLegacy.SetTreeAddresses(trueTree);
+  }
+
+  // event loop
+  mt19937_64        rng(12345);
+  vector<PseudoJet> recoCsts;
+  vector<PseudoJet> trueCsts;
+  double            tSelect(0.);
+  double            nTrkSelect(0.);
+  uint64_t          nAllocStart(0);
+  long              memWarmUp(0);
+  long              memMax(0);
+  auto              tStart = chrono::steady_clock::now();
+  for (size_t iEvt = 0; iEvt < cfg.nEvt; iEvt++) {
+
+    // start measuring once caches and baskets have warmed up
+    if (iEvt == cfg.nWarmUp) {
+      nAllocStart = nAllocs.load();
+      memWarmUp   = GetResidentMemory();
+      tStart      = chrono::steady_clock::now();
+    }
+
+    // generate event (not timed)
+    table.Reset();
+    recoCsts.clear();
+    trueCsts.clear();
+    GenerateTracks(rng, cfg.nTrk, table);
+    GenerateNeutrals(rng, cfg.nPar, 0, trueCsts);
+
+    // reco constituents: track selection + calorimeter clusters
+    {
+      SCorrelatorJetTreeMakerMonitor::Timer timer(monitor, SCorrelatorJetTreeMakerMonitor::STAGE::RECO_CSTS);
+      const auto tSelStart = chrono::steady_clock::now();
+      selector.Select(table);
+      const chrono::duration<double, micro> tSel = chrono::steady_clock::now() - tSelStart;
+      if (iEvt >= cfg.nWarmUp) {
+        tSelect    += tSel.count();
+        nTrkSelect += table.Size();
+      }
+
+      for (size_t iTrk = 0; iTrk < table.Size(); iTrk++) {
+        if (!selector.IsAccepted(iTrk)) continue;
+        PseudoJet trk(table.px[iTrk], table.py[iTrk], table.pz[iTrk], table.ene[iTrk]);
+        trk.set_user_index(table.matchID[iTrk]);
+        recoCsts.push_back(trk);
+      }
+      GenerateNeutrals(rng, cfg.nClust, table.Size(), recoCsts);
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NTRK_SEEN,   table.Size());
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NTRK_ACCEPT, selector.GetNAccepted());
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NRECO_CST,   recoCsts.size());
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NTRUE_CST,   trueCsts.size());
+    }
+
+    // clustering
+    {
+      SCorrelatorJetTreeMakerMonitor::Timer timer(monitor, SCorrelatorJetTreeMakerMonitor::STAGE::RECO_CLUST);
+      recoClusterer.Cluster(recoCsts);
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NRECO_JET, recoClusterer.GetJets().size());
+    }
+    {
+      SCorrelatorJetTreeMakerMonitor::Timer timer(monitor, SCorrelatorJetTreeMakerMonitor::STAGE::TRUE_CLUST);
+      trueClusterer.Cluster(trueCsts);
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NTRUE_JET, trueClusterer.GetJets().size());
+    }
+
+    // tree filling
+    {
+      SCorrelatorJetTreeMakerMonitor::Timer timer(monitor, SCorrelatorJetTreeMakerMonitor::STAGE::RECO_FILL);
+      if (cfg.doFlat) {
+        FillRecoOutput(recoClusterer.GetJets(), recoFlat);
+      } else {
+        FillRecoOutput(recoClusterer.GetJets(), recoLegacy);
+      }
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NBYTES_FILLED, max(recoTree -> Fill(), 0));
+    }
+    {
+      SCorrelatorJetTreeMakerMonitor::Timer timer(monitor, SCorrelatorJetTreeMakerMonitor::STAGE::TRUE_FILL);
+      if (cfg.doFlat) {
+        FillTrueOutput(trueClusterer.GetJets(), trueFlat);
+      } else {
+        FillTrueOutput(trueClusterer.GetJets(), trueLegacy);
+      }
+      monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NBYTES_FILLED, max(trueTree -> Fill(), 0));
+    }
+    monitor.Count(SCorrelatorJetTreeMakerMonitor::COUNT::NEVT);
+
+    // sample memory every 1% of the run (cheap enough not to skew timing)
+    if ((iEvt >= cfg.nWarmUp) && ((iEvt % max((size_t) 1, cfg.nEvt / 100)) == 0)) {
+      memMax = max(memMax, GetResidentMemory());
+    }
+  }  // end event loop
+
+  // collect results (measurement excludes warm-up events)
+  const chrono::duration<double> tLoop = chrono::steady_clock::now() - tStart;
+  const double nMeasured  = max(1., (double) (cfg.nEvt - cfg.nWarmUp));
+  const double evtRate    = nMeasured / tLoop.count();
+  const double allocRate  = (nAllocs.load() - nAllocStart) / nMeasured;
+  const double selPer10k  = (nTrkSelect > 0.) ? (tSelect / nTrkSelect) * 1e4 : 0.;
+  const long   memEnd     = GetResidentMemory();
+  const long   memGrowth  = max(memEnd, memMax) - memWarmUp;
+
+  // write output
+  file     -> cd();
+  recoTree -> Write();
+  trueTree -> Write();
+  file     -> Close();
+
+  // report
+  cout << "  Results (" << (size_t) nMeasured << " events after " << cfg.nWarmUp << " warm-up events):\n"
+       << "    events/s (w/ gen.)  = " << evtRate << "\n"
+       << "    allocations/event   = " << allocRate << "\n"
+       << "    selection [us/10k]  = " << selPer10k << "\n"
+       << "    peak RSS [kB]       = " << GetPeakMemory() << "\n"
+       << "    RSS growth [kB]     = " << memGrowth << " (" << memWarmUp << " -> " << memEnd << ", max. " << max(memEnd, memMax) << ")\n"
+       << "\n  Stage timing:"
+       << endl;
+  for (size_t iStage = 0; iStage < SCorrelatorJetTreeMakerMonitor::STAGE::NStage; iStage++) {
+    const SCorrelatorJetTreeMakerMonitor::STAGE stage = static_cast<SCorrelatorJetTreeMakerMonitor::STAGE>(iStage);
+    if (monitor.GetCalls(stage) == 0) continue;
+    cout << "    " << SCorrelatorJetTreeMakerMonitor::GetStageName(iStage) << " = " << monitor.GetTime(stage) / monitor.GetCalls(stage) << " ms/event" << endl;
+  }
+
+  // memory check (soak mode only)
+  if ((cfg.maxGrowth >= 0) && (memGrowth > cfg.maxGrowth)) {
+    cerr << "\n  FAILED: RSS grew by " << memGrowth << " kB after warm-up (limit = " << cfg.maxGrowth << " kB)\n" << endl;
+    return 1;
+  } else if (cfg.maxGrowth >= 0) {
+    cout << "\n  Memory check passed: RSS growth " << memGrowth << " kB <= " << cfg.maxGrowth << " kB" << endl;
+  }
+  cout << "\n  Benchmark finished!\n" << endl;
+  return 0;
+
+}  // end 'main(int, char**)'
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerCaloTable.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERCALOTABLE_H
+#define SCORRELATORJETTREEMAKERCALOTABLE_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerCaloTable definition ------------------------------
+
+  struct SCorrelatorJetTreeMakerCaloTable {
+
+    // cluster energy and position (cylindrical, as stored)
+    vector<int>    clustID;
+    vector<double> ecore;
+    vector<double> r;
+    vector<double> phi;
+    vector<double> z;
+
+    // vertex-corrected momenta (see ComputeMomenta)
+    vector<double> px;
+    vector<double> py;
+    vector<double> pz;
+    vector<double> ene;
+    vector<double> pt;
+    vector<double> eta;
+
+    // acceptance (see Select)
+    size_t          nAccept = 0;
+    vector<uint8_t> isGood;
+
+
+
+    size_t Size() const {
+      return ecore.size();
+    }  // end 'Size()'
+
+
+
+    void AddRow(const int rowID, const double rowECore, const double rowR, const double rowPhi, const double rowZ) {
+      clustID.push_back(rowID);
+      ecore.push_back(rowECore);
+      r.push_back(rowR);
+      phi.push_back(rowPhi);
+      z.push_back(rowZ);
+      return;
+    }  // end 'AddRow(int, double, double, double, double)'
+
+
+
+    void ComputeMomenta(const double vx, const double vy, const double vz) {
+
+      // same as RawClusterUtility::GetECoreVec: the vector from
+      // the vertex to the cluster, scaled to the core energy.
+      // sin and cos of the same angle get merged into one
+      // sincos call by the compiler
+      const size_t nRow = Size();
+      px.resize(nRow);
+      py.resize(nRow);
+      pz.resize(nRow);
+      ene.resize(nRow);
+      pt.resize(nRow);
+      eta.resize(nRow);
+      for (size_t iRow = 0; iRow < nRow; iRow++) {
+        const double sinPhi = sin(phi[iRow]);
+        const double cosPhi = cos(phi[iRow]);
+        const double dx     = (r[iRow] * cosPhi) - vx;
+        const double dy     = (r[iRow] * sinPhi) - vy;
+        const double dz     = z[iRow] - vz;
+        const double mag    = sqrt((dx * dx) + (dy * dy) + (dz * dz));
+        const double scale  = (mag > 0.) ? (ecore[iRow] / mag) : 0.;
+        px[iRow]  = dx * scale;
+        py[iRow]  = dy * scale;
+        pz[iRow]  = dz * scale;
+        ene[iRow] = abs(ecore[iRow]);
+        pt[iRow]  = sqrt((px[iRow] * px[iRow]) + (py[iRow] * py[iRow]));
+      }
+
+      // pseudorapidity in a separate pass so the loop above stays simple
+      for (size_t iRow = 0; iRow < nRow; iRow++) {
+        eta[iRow] = (pt[iRow] > 0.) ? asinh(pz[iRow] / pt[iRow]) : copysign(numeric_limits<double>::infinity(), pz[iRow]);
+      }
+      return;
+
+    }  // end 'ComputeMomenta(double, double, double)'
+
+
+
+    void Select(const pair<double, double> ptRange, const pair<double, double> etaRange) {
+
+      const size_t nRow = Size();
+      isGood.assign(nRow, 1);
+      nAccept = 0;
+      for (size_t iRow = 0; iRow < nRow; iRow++) {
+        isGood[iRow] &= ((pt[iRow]  > ptRange.first)  & (pt[iRow]  < ptRange.second));
+        isGood[iRow] &= ((eta[iRow] > etaRange.first) & (eta[iRow] < etaRange.second));
+        nAccept      += isGood[iRow];
+      }
+      return;
+
+    }  // end 'Select(pair<double, double>, pair<double, double>)'
+
+
+
+    void Reserve(const size_t nRow) {
+
+      clustID.reserve(nRow);
+      ecore.reserve(nRow);
+      r.reserve(nRow);
+      phi.reserve(nRow);
+      z.reserve(nRow);
+      return;
+
+    }  // end 'Reserve(size_t)'
+
+
+
+    void Reset() {
+
+      // clear columns (capacity is kept between events)
+      clustID.clear();
+      ecore.clear();
+      r.clear();
+      phi.clear();
+      z.clear();
+      px.clear();
+      py.clear();
+      pz.clear();
+      ene.clear();
+      pt.clear();
+      eta.clear();
+      isGood.clear();
+      nAccept = 0;
+      return;
+
+    }  // end 'Reset()'
+
+  };  // end SCorrelatorJetTreeMakerCaloTable
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerClusterer.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERCLUSTERER_H
+#define SCORRELATORJETTREEMAKERCLUSTERER_H
+
+// c++ utilities
+#include <limits>
+#include <memory>
+#include <vector>
+#include <algorithm>
+// fastjet libraries
+#include <fastjet/Selector.hh>
+#include <fastjet/PseudoJet.hh>
+#include <fastjet/JetDefinition.hh>
+#include <fastjet/AreaDefinition.hh>
+#include <fastjet/GhostedAreaSpec.hh>
+#include <fastjet/ClusterSequence.hh>
+#include <fastjet/ClusterSequenceArea.hh>
+#include <fastjet/ClusterSequenceActiveAreaExplicitGhosts.hh>
+
+// make common namespaces implicit
+using namespace std;
+using namespace fastjet;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerAreaConfig definition -----------------------------
+
+  struct SCorrelatorJetTreeMakerAreaConfig {
+
+    // NONE leaves areas at 0, ACTIVE clusters with a fixed grid of
+    // ghosts made once per job, VORONOI uses no ghosts at all
+    enum TYPE {NONE = 0, ACTIVE = 1, VORONOI = 2};
+
+    TYPE   type        = TYPE::NONE;
+    double ghostMaxRap = 0.;    // if 0, set from the constituent acceptance + R
+    double ghostArea   = 0.01;
+    double voronoiR    = 1.;    // effective radius (in units of R) for voronoi areas
+
+  };  // end SCorrelatorJetTreeMakerAreaConfig
+
+
+
+  // SCorrelatorJetTreeMakerClusterer definition ------------------------------
+
+  class SCorrelatorJetTreeMakerClusterer {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerClusterer() {};
+      SCorrelatorJetTreeMakerClusterer(const JetDefinition& jetDef) : m_jetDef(jetDef) {};
+      ~SCorrelatorJetTreeMakerClusterer() {};
+
+      // copies get their own copy of the jet definition and of the
+      // already generated ghosts (so that e.g. batch workers cluster
+      // with exactly the same ghosts as the serial path, without
+      // generating new ones), but not the last event's cluster
+      // sequence or jets
+      SCorrelatorJetTreeMakerClusterer(const SCorrelatorJetTreeMakerClusterer& other) :
+        m_ghostArea(other.m_ghostArea),
+        m_jetDef(other.m_jetDef),
+        m_ghosts(other.m_ghosts),
+        m_areaConfig(other.m_areaConfig) {};
+      SCorrelatorJetTreeMakerClusterer(SCorrelatorJetTreeMakerClusterer&& other) = default;
+      SCorrelatorJetTreeMakerClusterer& operator=(SCorrelatorJetTreeMakerClusterer&& other) = default;
+      SCorrelatorJetTreeMakerClusterer& operator=(const SCorrelatorJetTreeMakerClusterer& other) {
+        if (this != &other) {
+          Reset();
+          m_nClustered = 0;
+          m_ghostArea  = other.m_ghostArea;
+          m_jetDef     = other.m_jetDef;
+          m_ghosts     = other.m_ghosts;
+          m_areaConfig = other.m_areaConfig;
+        }
+        return *this;
+      }
+
+      // setters
+      void SetJetDefinition(const JetDefinition& jetDef) {m_jetDef = jetDef;}
+
+      // getters
+      size_t                                   GetNClustered()      const {return m_nClustered;}
+      size_t                                   GetNGhosts()         const {return m_ghosts.size();}
+      const JetDefinition&                     GetJetDefinition()   const {return m_jetDef;}
+      const SCorrelatorJetTreeMakerAreaConfig& GetAreaConfig()      const {return m_areaConfig;}
+      const ClusterSequence*                   GetClusterSequence() const {return m_clust.get();}
+      const vector<PseudoJet>&                 GetJets()            const {return m_jets;}
+
+      // ghosts are flagged so they can be told apart from real constituents
+      static const int GhostIndex = numeric_limits<int>::min();
+
+
+
+      void SetAreaConfig(const SCorrelatorJetTreeMakerAreaConfig& config) {
+
+        // the ghost grid only depends on the acceptance, so it's
+        // built here once and handed to every event's clustering.
+        // generating ghosts uses fastjet's shared random number
+        // generator: call this from one thread only, and copy the
+        // clusterer to use the grid elsewhere
+        m_areaConfig = config;
+        m_ghosts.clear();
+        if (m_areaConfig.type == SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE) {
+          GhostedAreaSpec ghostSpec(m_areaConfig.ghostMaxRap, 1, m_areaConfig.ghostArea);
+          ghostSpec.add_ghosts(m_ghosts);
+          for (PseudoJet& ghost : m_ghosts) {
+            ghost.set_user_index(GhostIndex);
+          }
+          m_ghostArea = ghostSpec.actual_ghost_area();
+        }
+        return;
+
+      }  // end 'SetAreaConfig(SCorrelatorJetTreeMakerAreaConfig&)'
+
+
+
+      const vector<PseudoJet>& Cluster(const vector<PseudoJet>& csts) {
+
+        // release the previous event's sequence before building the
+        // next one so that at most one sequence is alive at a time;
+        // the jet definition is owned for the lifetime of the job
+        m_clust.reset();
+        switch (m_areaConfig.type) {
+          case SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE:
+            m_clust = make_unique<ClusterSequenceActiveAreaExplicitGhosts>(csts, m_jetDef, m_ghosts, m_ghostArea);
+            break;
+          case SCorrelatorJetTreeMakerAreaConfig::TYPE::VORONOI:
+            m_clust = make_unique<ClusterSequenceArea>(csts, m_jetDef, AreaDefinition(VoronoiAreaSpec(m_areaConfig.voronoiR)));
+            break;
+          default:
+            m_clust = make_unique<ClusterSequence>(csts, m_jetDef);
+            break;
+        }
+
+        // jets (and their constituents) stay valid until the next call
+        m_jets = m_clust -> inclusive_jets();
+        if (m_areaConfig.type == SCorrelatorJetTreeMakerAreaConfig::TYPE::ACTIVE) {
+          m_jets = (!SelectorIsPureGhost())(m_jets);
+        }
+        ++m_nClustered;
+        return m_jets;
+
+      }  // end 'Cluster(vector<PseudoJet>&)'
+
+
+
+      // constituents of a jet without any ghosts
+      static vector<PseudoJet> GetConstituents(const PseudoJet& jet) {
+
+        vector<PseudoJet> csts = jet.constituents();
+        csts.erase(
+          remove_if(csts.begin(), csts.end(), [](const PseudoJet& cst) {return (cst.user_index() == GhostIndex);}),
+          csts.end()
+        );
+        return csts;
+
+      }  // end 'GetConstituents(PseudoJet&)'
+
+
+
+      // area of a jet (0 if areas are off)
+      static double GetArea(const PseudoJet& jet) {
+        return jet.has_area() ? jet.area() : 0.;
+      }  // end 'GetArea(PseudoJet&)'
+
+
+
+      void Reset() {
+
+        m_clust.reset();
+        m_jets.clear();
+        return;
+
+      }  // end 'Reset()'
+
+    private:
+
+      // members
+      size_t                            m_nClustered = 0;
+      double                            m_ghostArea  = 0.;
+      JetDefinition                     m_jetDef;
+      vector<PseudoJet>                 m_jets;
+      vector<PseudoJet>                 m_ghosts;
+      unique_ptr<ClusterSequence>       m_clust;
+      SCorrelatorJetTreeMakerAreaConfig m_areaConfig;
+
+  };  // end SCorrelatorJetTreeMakerClusterer
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -16,6 +16,79 @@
 
 namespace SColdQcdCorrelatorAnalysis {
 
+  // SCorrelatorJetTreeMakerJetConfig definition ------------------------------
+
+  struct SCorrelatorJetTreeMakerJetConfig {
+
+    double              rJet   = 0.4;
+    JetAlgorithm        algo   = antikt_algorithm;
+    RecombinationScheme recomb = pt_scheme;
+    string              tag    = "";
+
+
+
+    JetDefinition GetJetDefinition() const {
+      return JetDefinition(algo, rJet, recomb, fastjet::Best);
+    }  // end 'GetJetDefinition()'
+
+
+
+    string MakeTag() const {
+
+      // algorithm label
+      string algoTag;
+      switch (algo) {
+        case antikt_algorithm:
+          algoTag = "AntiKt";
+          break;
+        case kt_algorithm:
+          algoTag = "Kt";
+          break;
+        case cambridge_algorithm:
+          algoTag = "CA";
+          break;
+        default:
+          algoTag = "Jet";
+          break;
+      }
+
+      // recombination scheme label
+      string recombTag;
+      switch (recomb) {
+        case E_scheme:
+          recombTag = "E";
+          break;
+        case pt_scheme:
+          recombTag = "Pt";
+          break;
+        case pt2_scheme:
+          recombTag = "Pt2";
+          break;
+        case Et_scheme:
+          recombTag = "Et";
+          break;
+        case Et2_scheme:
+          recombTag = "Et2";
+          break;
+        default:
+          recombTag = "Other";
+          break;
+      }
+
+      // resolution parameter label, e.g. R = 0.4 --> "R040"
+      const long rTimes100 = lround(rJet * 100.);
+      string     rTag      = to_string(rTimes100);
+      while (rTag.size() < 3) {
+        rTag.insert(0, "0");
+      }
+      return algoTag + "_R" + rTag + "_" + recombTag + "Scheme";
+
+    }  // end 'MakeTag()'
+
+  };  // end SCorrelatorJetTreeMakerJetConfig
+
+
+
   // SCorrelatorJetTreeMakerConfig definition ---------------------------------
 
   struct SCorrelatorJetTreeMakerConfig {
@@ -37,6 +110,45 @@ namespace SColdQcdCorrelatorAnalysis {
     bool m_addFlow        = false;
     bool m_addECal        = false;
     bool m_addHCal        = false;
+    bool m_doFlatOutput   = false;
+    bool m_doTiming       = false;
+    bool m_doParallelJets = false;
+    bool m_doAsyncWrite   = false;
+    bool m_doFloatOutput  = false;
+    bool m_doTreeOutput   = true;
+    bool m_doNTupleOutput = false;
+
+    // for multi-threaded batch mode (off if no. of threads is 0)
+    size_t m_nBatchThreads  = 0;
+    size_t m_batchQueueSize = 64;
+
+    // for stage timing and counters
+    string m_timingJsonName = "";
+
+    // mantissa bits kept per column if writing kinematics as floats
+    SCorrelatorJetTreeMakerPrecision m_precision;
+
+    // output compression, basket, and cluster settings
+    SCorrelatorJetTreeMakerWriteConfig m_writeConfig;
+
+    // jet area calculation (off by default)
+    SCorrelatorJetTreeMakerAreaConfig m_areaConfig;
+
+    // background estimation and subtraction (off by default)
+    SCorrelatorJetTreeMakerBkgdConfig m_bkgdConfig;
+
+    // truth-reco jet matching (off by default)
+    SCorrelatorJetTreeMakerMatchConfig m_matchConfig;
+
+    // tpc sector boundary width and dead sectors, plus an
+    // optional run-indexed table of dead sectors
+    SCorrelatorJetTreeMakerTpcSectorConfig m_tpcSectorConfig;
+    string                                 m_tpcDeadSectorFile = "";
+
+    // for parquet output (needs --enable-parquet)
+    bool      m_doParquetOutput     = false;
+    string    m_parquetBaseName     = "";
+    long long m_parquetRowGroupSize = 65536;
 
     // event acceptance parameters
     // TODO convert most acceptances to pairs/pairs of structs
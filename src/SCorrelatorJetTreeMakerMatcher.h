@@ -0,0 +1,321 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerMatcher.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERMATCHER_H
+#define SCORRELATORJETTREEMAKERMATCHER_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+// fastjet libraries
+#include <fastjet/PseudoJet.hh>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerOutput.h"
+#include "SCorrelatorJetTreeMakerClusterer.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace fastjet;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerMatchConfig definition ----------------------------
+
+  struct SCorrelatorJetTreeMakerMatchConfig {
+
+    bool   doMatch = false;
+    double maxDr   = 0.3;  // max. eta-phi distance for geometric matches
+
+  };  // end SCorrelatorJetTreeMakerMatchConfig
+
+
+
+  // SCorrelatorJetTreeMakerJetMatch definition -------------------------------
+
+  struct SCorrelatorJetTreeMakerJetMatch {
+
+    int    jetID     = -1;
+    double jetDr     = numeric_limits<double>::max();
+    int    cstJetID  = -1;
+    double shareFrac = 0.;
+
+  };  // end SCorrelatorJetTreeMakerJetMatch
+
+
+
+  // SCorrelatorJetTreeMakerJetMatcher definition -----------------------------
+
+  // Matches truth and reco jets of one configuration in both directions:
+  //   - geometrically, to the closest jet within maxDr. Truth jets are
+  //     binned in an eta-phi grid with cells at least maxDr wide, so
+  //     each reco jet only looks at the 3x3 cells around it;
+  //   - by constituents, to the jet sharing the most energy. Truth
+  //     barcodes are hashed once per event and looked up with the
+  //     matched barcode of each reco constituent.
+  // Barcodes are looked up by user index (i.e. the constituent's row in
+  // the event's provenance table); constituents without one (-1, e.g.
+  // calorimeter clusters) and ghosts are ignored.
+
+  class SCorrelatorJetTreeMakerJetMatcher {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerJetMatcher() {};
+      ~SCorrelatorJetTreeMakerJetMatcher() {};
+
+      // getters
+      const vector<SCorrelatorJetTreeMakerJetMatch>& GetRecoMatches() const {return m_recoMatches;}
+      const vector<SCorrelatorJetTreeMakerJetMatch>& GetTrueMatches() const {return m_trueMatches;}
+      const SCorrelatorJetTreeMakerMatchConfig&      GetConfig()      const {return m_config;}
+
+      // setters
+      void SetConfig(const SCorrelatorJetTreeMakerMatchConfig& config) {m_config = config;}
+
+
+
+      void Match(const vector<PseudoJet>& recoJets, const vector<PseudoJet>& trueJets, const vector<int>& recoBarcodes, const vector<int>& trueBarcodes) {
+
+        m_recoMatches.assign(recoJets.size(), SCorrelatorJetTreeMakerJetMatch());
+        m_trueMatches.assign(trueJets.size(), SCorrelatorJetTreeMakerJetMatch());
+        if (recoJets.empty() || trueJets.empty()) return;
+
+        MatchGeometric(recoJets, trueJets);
+        MatchConstituents(recoJets, trueJets, recoBarcodes, trueBarcodes);
+        return;
+
+      }  // end 'Match(vector<PseudoJet>&, vector<PseudoJet>&, vector<int>&, vector<int>&)'
+
+
+
+      // copy matches into the output columns; has to
+      // happen after the output's jets were added
+      void FillRecoColumns(SCorrelatorJetTreeMakerMatchColumns& columns) const {
+        FillColumns(m_recoMatches, columns);
+        return;
+      }  // end 'FillRecoColumns(SCorrelatorJetTreeMakerMatchColumns&)'
+
+      void FillTrueColumns(SCorrelatorJetTreeMakerMatchColumns& columns) const {
+        FillColumns(m_trueMatches, columns);
+        return;
+      }  // end 'FillTrueColumns(SCorrelatorJetTreeMakerMatchColumns&)'
+
+    private:
+
+      // a truth particle hashed by barcode: jet it ended up in, its energy,
+      // and the last reco jet it was counted for (avoids double counting
+      // if several tracks are matched to the same particle)
+      struct Barcode {
+        size_t trueJet;
+        double ene;
+        int    lastReco;
+      };
+
+      // energy a reco jet shares with one truth jet
+      struct Shared {
+        size_t trueJet;
+        double recoEne;
+        double trueEne;
+      };
+
+
+
+      static void FillColumns(const vector<SCorrelatorJetTreeMakerJetMatch>& matches, SCorrelatorJetTreeMakerMatchColumns& columns) {
+        columns.Reset();
+        for (const SCorrelatorJetTreeMakerJetMatch& match : matches) {
+          columns.AddJet(match.jetID, match.jetDr, match.cstJetID, match.shareFrac);
+        }
+        return;
+      }  // end 'FillColumns(vector<SCorrelatorJetTreeMakerJetMatch>&, SCorrelatorJetTreeMakerMatchColumns&)'
+
+
+
+      void MatchGeometric(const vector<PseudoJet>& recoJets, const vector<PseudoJet>& trueJets) {
+
+        // size grid to cover truth jets, cells no smaller than maxDr
+        const double cellSize = max(m_config.maxDr, 0.01);
+        double       etaMin   = numeric_limits<double>::max();
+        double       etaMax   = numeric_limits<double>::lowest();
+        for (const PseudoJet& jet : trueJets) {
+          etaMin = min(etaMin, jet.pseudorapidity());
+          etaMax = max(etaMax, jet.pseudorapidity());
+        }
+        m_etaMin  = etaMin;
+        m_nEta    = (int) floor((etaMax - etaMin) / cellSize) + 1;
+        m_nPhi    = max((int) floor(2. * M_PI / cellSize), 1);
+        m_phiSize = 2. * M_PI / m_nPhi;
+        m_etaSize = cellSize;
+
+        // bin truth jets (cells keep their capacity between events)
+        const size_t nCells = m_nEta * m_nPhi;
+        if (m_cells.size() < nCells) m_cells.resize(nCells);
+        for (size_t iCell = 0; iCell < nCells; iCell++) {
+          m_cells[iCell].clear();
+        }
+        for (size_t iTrue = 0; iTrue < trueJets.size(); iTrue++) {
+          const int iEta = GetEtaCell(trueJets[iTrue].pseudorapidity());
+          const int iPhi = GetPhiCell(trueJets[iTrue].phi_std());
+          m_cells[(iEta * m_nPhi) + iPhi].push_back(iTrue);
+        }
+
+        // for each reco jet, look in neighbouring cells (phi wraps around)
+        const double dr2Max = m_config.maxDr * m_config.maxDr;
+        for (size_t iReco = 0; iReco < recoJets.size(); iReco++) {
+          const double recoEta = recoJets[iReco].pseudorapidity();
+          const double recoPhi = recoJets[iReco].phi_std();
+          const int    iEta    = (int) floor((recoEta - m_etaMin) / m_etaSize);
+          const int    iPhi    = GetPhiCell(recoPhi);
+          const int    nDPhi   = min(m_nPhi, 3);
+
+          for (int jEta = iEta - 1; jEta <= iEta + 1; jEta++) {
+            if ((jEta < 0) || (jEta >= m_nEta)) continue;
+            for (int dPhi = 0; dPhi < nDPhi; dPhi++) {
+              const int jPhi = (iPhi + dPhi - 1 + m_nPhi) % m_nPhi;
+              for (const size_t iTrue : m_cells[(jEta * m_nPhi) + jPhi]) {
+
+                const double dr2 = GetDr2(recoEta, recoPhi, trueJets[iTrue].pseudorapidity(), trueJets[iTrue].phi_std());
+                if (dr2 > dr2Max) continue;
+
+                // keep closest in both directions
+                const double dr = sqrt(dr2);
+                if (dr < m_recoMatches[iReco].jetDr) {
+                  m_recoMatches[iReco].jetID = iTrue;
+                  m_recoMatches[iReco].jetDr = dr;
+                }
+                if (dr < m_trueMatches[iTrue].jetDr) {
+                  m_trueMatches[iTrue].jetID = iReco;
+                  m_trueMatches[iTrue].jetDr = dr;
+                }
+              }
+            }
+          }
+        }  // end reco jet loop
+        return;
+
+      }  // end 'MatchGeometric(vector<PseudoJet>&, vector<PseudoJet>&)'
+
+
+
+      void MatchConstituents(const vector<PseudoJet>& recoJets, const vector<PseudoJet>& trueJets, const vector<int>& recoBarcodes, const vector<int>& trueBarcodes) {
+
+        // hash truth constituents by barcode
+        m_barcodes.clear();
+        for (size_t iTrue = 0; iTrue < trueJets.size(); iTrue++) {
+          for (const PseudoJet& cst : SCorrelatorJetTreeMakerClusterer::GetConstituents(trueJets[iTrue])) {
+            const int barcode = GetBarcode(cst, trueBarcodes);
+            if (barcode < 0) continue;
+            m_barcodes[barcode] = {iTrue, cst.E(), -1};
+          }
+        }
+
+        // energy each truth jet shares with its best reco jet so far
+        m_trueShared.assign(trueJets.size(), 0.);
+
+        for (size_t iReco = 0; iReco < recoJets.size(); iReco++) {
+
+          // sum shared energy per truth jet (only a few per reco jet)
+          m_shared.clear();
+          for (const PseudoJet& cst : SCorrelatorJetTreeMakerClusterer::GetConstituents(recoJets[iReco])) {
+            const int barcode = GetBarcode(cst, recoBarcodes);
+            if (barcode < 0) continue;
+
+            unordered_map<int, Barcode>::iterator itCode = m_barcodes.find(barcode);
+            if (itCode == m_barcodes.end()) continue;
+
+            Barcode& code = itCode -> second;
+            vector<Shared>::iterator itShared = find_if(m_shared.begin(), m_shared.end(), [&code](const Shared& shared) {return (shared.trueJet == code.trueJet);});
+            if (itShared == m_shared.end()) {
+              m_shared.push_back({code.trueJet, 0., 0.});
+              itShared = m_shared.end() - 1;
+            }
+            itShared -> recoEne += cst.E();
+            if (code.lastReco != (int) iReco) {
+              itShared -> trueEne += code.ene;
+              code.lastReco        = iReco;
+            }
+          }
+
+          // pick truth jet sharing the most (reco) energy, and let
+          // each truth jet keep the reco jet sharing the most (truth) energy
+          double recoShared = 0.;
+          for (const Shared& shared : m_shared) {
+            if (shared.recoEne > recoShared) {
+              recoShared                    = shared.recoEne;
+              m_recoMatches[iReco].cstJetID = shared.trueJet;
+            }
+            if (shared.trueEne > m_trueShared[shared.trueJet]) {
+              m_trueShared[shared.trueJet]           = shared.trueEne;
+              m_trueMatches[shared.trueJet].cstJetID = iReco;
+            }
+          }
+          m_recoMatches[iReco].shareFrac = (recoJets[iReco].E() > 0.) ? recoShared / recoJets[iReco].E() : 0.;
+        }  // end reco jet loop
+
+        for (size_t iTrue = 0; iTrue < trueJets.size(); iTrue++) {
+          m_trueMatches[iTrue].shareFrac = (trueJets[iTrue].E() > 0.) ? m_trueShared[iTrue] / trueJets[iTrue].E() : 0.;
+        }
+        return;
+
+      }  // end 'MatchConstituents(vector<PseudoJet>&, vector<PseudoJet>&, vector<int>&, vector<int>&)'
+
+
+
+      static int GetBarcode(const PseudoJet& cst, const vector<int>& barcodes) {
+        const int iRow = cst.user_index();
+        return ((iRow >= 0) && ((size_t) iRow < barcodes.size())) ? barcodes[iRow] : -1;
+      }  // end 'GetBarcode(PseudoJet&, vector<int>&)'
+
+
+
+      int GetEtaCell(const double eta) const {
+        return min(max((int) floor((eta - m_etaMin) / m_etaSize), 0), m_nEta - 1);
+      }  // end 'GetEtaCell(double)'
+
+      int GetPhiCell(const double phi) const {
+        return min(max((int) floor((phi + M_PI) / m_phiSize), 0), m_nPhi - 1);
+      }  // end 'GetPhiCell(double)'
+
+      static double GetDr2(const double eta1, const double phi1, const double eta2, const double phi2) {
+        const double dEta = eta1 - eta2;
+        const double dPhi = remainder(phi1 - phi2, 2. * M_PI);
+        return (dEta * dEta) + (dPhi * dPhi);
+      }  // end 'GetDr2(double x 4)'
+
+      // members
+      SCorrelatorJetTreeMakerMatchConfig      m_config;
+      vector<SCorrelatorJetTreeMakerJetMatch> m_recoMatches;
+      vector<SCorrelatorJetTreeMakerJetMatch> m_trueMatches;
+
+      // eta-phi grid of truth jets
+      int                    m_nEta    = 0;
+      int                    m_nPhi    = 0;
+      double                 m_etaMin  = 0.;
+      double                 m_etaSize = 0.;
+      double                 m_phiSize = 0.;
+      vector<vector<size_t>> m_cells;
+
+      // barcode hash and scratch space for shared energies
+      unordered_map<int, Barcode> m_barcodes;
+      vector<Shared>              m_shared;
+      vector<double>              m_trueShared;
+
+  };  // end SCorrelatorJetTreeMakerJetMatcher
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,251 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerMonitor.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERMONITOR_H
+#define SCORRELATORJETTREEMAKERMONITOR_H
+
+// c++ utilities
+#include <array>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerMonitor definition --------------------------------
+
+  class SCorrelatorJetTreeMakerMonitor {
+
+    public:
+
+      // stages of process_event
+      enum STAGE {
+        EVENT,
+        VERTEX,
+        EVALS,
+        EVTVARS,
+        PARTONS,
+        RECO_CSTS,
+        TRUE_CSTS,
+        RECO_CLUST,
+        TRUE_CLUST,
+        RECO_FILL,
+        TRUE_FILL,
+        MATCH,
+        WRITE,
+        NStage
+      };
+
+      // counters
+      enum COUNT {
+        NEVT,
+        NEVT_ACCEPT,
+        NEVT_EARLY_EXIT,
+        NSTAGE_SKIPPED,
+        NTRK_SEEN,
+        NTRK_ACCEPT,
+        NRECO_CST,
+        NTRUE_CST,
+        NRECO_JET,
+        NTRUE_JET,
+        NBYTES_FILLED,
+        NCount
+      };
+
+
+
+      // scoped timer: adds elapsed time to a stage on destruction
+      class Timer {
+
+        public:
+
+          Timer(SCorrelatorJetTreeMakerMonitor& monitor, const STAGE stage) : m_monitor(monitor), m_stage(stage) {
+            if (m_monitor.IsEnabled()) {
+              m_start = chrono::steady_clock::now();
+            }
+          }
+
+          ~Timer() {
+            if (m_monitor.IsEnabled()) {
+              const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - m_start;
+              m_monitor.AddTime(m_stage, elapsed.count());
+            }
+          }
+
+        private:
+
+          SCorrelatorJetTreeMakerMonitor&    m_monitor;
+          STAGE                              m_stage;
+          chrono::steady_clock::time_point   m_start;
+
+      };  // end Timer
+
+
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerMonitor() {
+        m_time.fill(0.);
+        m_calls.fill(0);
+        m_counts.fill(0);
+      };
+      ~SCorrelatorJetTreeMakerMonitor() {};
+
+      // setters
+      void SetEnabled(const bool enable) {m_isEnabled = enable;}
+
+      // getters
+      bool     IsEnabled()                    const {return m_isEnabled;}
+      double   GetTime(const STAGE stage)     const {return m_time[stage];}
+      uint64_t GetCalls(const STAGE stage)    const {return m_calls[stage];}
+      uint64_t GetCount(const COUNT counter)  const {return m_counts[counter];}
+
+
+
+      void AddTime(const STAGE stage, const double time) {
+        m_time[stage] += time;
+        ++m_calls[stage];
+        return;
+      }  // end 'AddTime(STAGE, double)'
+
+
+
+      void Count(const COUNT counter, const uint64_t num = 1) {
+        if (m_isEnabled) {
+          m_counts[counter] += num;
+        }
+        return;
+      }  // end 'Count(COUNT, uint64_t)'
+
+
+
+      void Merge(const SCorrelatorJetTreeMakerMonitor& other) {
+        for (size_t iStage = 0; iStage < STAGE::NStage; iStage++) {
+          m_time[iStage]  += other.m_time[iStage];
+          m_calls[iStage] += other.m_calls[iStage];
+        }
+        for (size_t iCount = 0; iCount < COUNT::NCount; iCount++) {
+          m_counts[iCount] += other.m_counts[iCount];
+        }
+        return;
+      }  // end 'Merge(SCorrelatorJetTreeMakerMonitor&)'
+
+
+
+      static bool IsTruthStage(const size_t stage) {
+        return (stage == EVALS) || (stage == PARTONS) || (stage == TRUE_CSTS) || (stage == TRUE_CLUST) || (stage == TRUE_FILL) || (stage == MATCH);
+      }  // end 'IsTruthStage(size_t)'
+
+
+
+      // no. of stages an event rejected by the vertex cut skips:
+      // everything after VERTEX except the writer's WRITE, and
+      // only the reco stages for data
+      static uint64_t GetNStageAfterVertex(const bool isMC) {
+        uint64_t nStage = 0;
+        for (size_t iStage = STAGE::VERTEX + 1; iStage < STAGE::NStage; iStage++) {
+          if ((iStage == STAGE::WRITE) || (!isMC && IsTruthStage(iStage))) {
+            continue;
+          }
+          ++nStage;
+        }
+        return nStage;
+      }  // end 'GetNStageAfterVertex(bool)'
+
+
+
+      static string GetStageName(const size_t stage) {
+        const array<string, STAGE::NStage> names = {
+          "Event",
+          "GetEventVertex",
+          "InitEvals",
+          "GetEventVariables",
+          "GetPartonInfo",
+          "RecoConstituents",
+          "TruthConstituents",
+          "RecoClustering",
+          "TruthClustering",
+          "FillRecoTree",
+          "FillTrueTree",
+          "MatchJets",
+          "WriteTrees"
+        };
+        return names.at(stage);
+      }  // end 'GetStageName(size_t)'
+
+
+
+      static string GetCountName(const size_t counter) {
+        const array<string, COUNT::NCount> names = {
+          "Events",
+          "EventsAccepted",
+          "EventsExitedEarly",
+          "StagesSkipped",
+          "TracksSeen",
+          "TracksAccepted",
+          "RecoConstituents",
+          "TruthConstituents",
+          "RecoJets",
+          "TruthJets",
+          "BytesFilled"
+        };
+        return names.at(counter);
+      }  // end 'GetCountName(size_t)'
+
+
+
+      void WriteJson(const string& fileName) const {
+
+        ofstream json(fileName);
+        if (!json.good()) {
+          cerr << "SCorrelatorJetTreeMakerMonitor::WriteJson(string) WARNING: couldn't open '" << fileName << "'!" << endl;
+          return;
+        }
+
+        // stage timing (in ms) and number of calls
+        json << "{\n  \"stages\": {\n";
+        for (size_t iStage = 0; iStage < STAGE::NStage; iStage++) {
+          json << "    \"" << GetStageName(iStage) << "\": {\"time_ms\": " << m_time[iStage] << ", \"calls\": " << m_calls[iStage] << "}";
+          json << ((iStage + 1 < STAGE::NStage) ? ",\n" : "\n");
+        }
+
+        // counters
+        json << "  },\n  \"counters\": {\n";
+        for (size_t iCount = 0; iCount < COUNT::NCount; iCount++) {
+          json << "    \"" << GetCountName(iCount) << "\": " << m_counts[iCount];
+          json << ((iCount + 1 < COUNT::NCount) ? ",\n" : "\n");
+        }
+        json << "  }\n}" << endl;
+        return;
+
+      }  // end 'WriteJson(string&)'
+
+    private:
+
+      // members
+      bool                             m_isEnabled = false;
+      array<double, STAGE::NStage>     m_time;
+      array<uint64_t, STAGE::NStage>   m_calls;
+      array<uint64_t, COUNT::NCount>   m_counts;
+
+  };  // end SCorrelatorJetTreeMakerMonitor
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerNTuple.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERNTUPLE_H
+#define SCORRELATORJETTREEMAKERNTUPLE_H
+
+// c++ utilities
+#include <memory>
+#include <string>
+#include <utility>
+#include <iostream>
+// root libraries
+#include <TFile.h>
+#include <RVersion.h>
+#ifdef SCORRELATOR_USE_RNTUPLE
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,32,0)
+#error "the rntuple output backend needs ROOT 6.32 or newer"
+#endif
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleWriter.hxx>
+#include <ROOT/RNTupleWriteOptions.hxx>
+#endif
+// analysis definitions
+#include "SCorrelatorJetTreeMakerWriteConfig.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // needs root 6.32 or newer (configure with --enable-rntuple);
+  // RNTuple left the experimental namespace in 6.36
+#ifdef SCORRELATOR_USE_RNTUPLE
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,36,0)
+  namespace RNTupleAPI = ROOT;
+#else
+  namespace RNTupleAPI = ROOT::Experimental;
+#endif
+#endif
+
+
+
+  // SCorrelatorJetTreeMakerNTupleWriter definition ---------------------------
+
+  // Writes one event-model struct (SCorrelatorJetTreeMakerRecoOutput or
+  // SCorrelatorJetTreeMakerTruthOutput) per entry into an RNTuple in
+  // the output file. Jets and constituents become nested collections.
+  // Without --enable-rntuple the writer only warns and drops its input.
+
+  template <typename TEvent> class SCorrelatorJetTreeMakerNTupleWriter {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerNTupleWriter(const string& name, const string& field, TFile* file, const SCorrelatorJetTreeMakerWriteConfig& config) {
+
+#ifndef SCORRELATOR_USE_RNTUPLE
+        cerr << "WARNING: rntuple output requested for '" << name << "' but module was built without --enable-rntuple! Nothing will be written." << endl;
+        m_event = make_shared<TEvent>();
+#else
+        unique_ptr<RNTupleAPI::RNTupleModel> model = RNTupleAPI::RNTupleModel::Create();
+        m_event = model -> MakeField<TEvent>(field);
+
+        // use same compression as the trees
+        RNTupleAPI::RNTupleWriteOptions options;
+        if (config.compAlgo != SCorrelatorJetTreeMakerWriteConfig::COMP::DEFAULT) {
+          options.SetCompression(config.GetCompressionSettings());
+        }
+        m_writer = RNTupleAPI::RNTupleWriter::Append(move(model), name, *file, options);
+#endif
+
+      }  // end ctor(string&, string&, TFile*, SCorrelatorJetTreeMakerWriteConfig&)
+
+      ~SCorrelatorJetTreeMakerNTupleWriter() {};
+
+      // getters
+      TEvent& GetEvent() {return *m_event;}
+
+
+
+      void Fill() {
+#ifdef SCORRELATOR_USE_RNTUPLE
+        m_writer -> Fill();
+#endif
+        return;
+      }  // end 'Fill()'
+
+
+
+      // flushes remaining clusters and writes the anchor;
+      // has to happen before the output file is closed
+      void Commit() {
+#ifdef SCORRELATOR_USE_RNTUPLE
+        m_writer.reset();
+#endif
+        return;
+      }  // end 'Commit()'
+
+    private:
+
+      // members
+      shared_ptr<TEvent>                    m_event;
+#ifdef SCORRELATOR_USE_RNTUPLE
+      unique_ptr<RNTupleAPI::RNTupleWriter> m_writer;
+#endif
+
+  };  // end SCorrelatorJetTreeMakerNTupleWriter
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
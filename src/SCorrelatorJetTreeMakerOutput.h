@@ -12,6 +12,16 @@
 #ifndef SCORRELATORJETTREEMAKEROUTPUT_H
 #define SCORRELATORJETTREEMAKEROUTPUT_H
 
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+// root libraries
+#include <TTree.h>
+
 // make common namespaces implicit
 using namespace std;
 
@@ -21,20 +31,443 @@ namespace SColdQcdCorrelatorAnalysis {
 
   // SCorrelatorJetTreeMakerOutput definition ---------------------------------
 
+  // Event model: each event holds a collection of jets, and each jet a
+  // collection of constituents. Written as-is by the RNTuple backend,
+  // which stores every member as its own (nested) column.
+
+  struct SCorrelatorJetTreeMakerTruthCst {
+
+    int    id      = numeric_limits<int>::max();
+    int    embedID = numeric_limits<int>::max();
+    double z       = numeric_limits<double>::max();
+    double dr      = numeric_limits<double>::max();
+    double ene     = numeric_limits<double>::max();
+    double pt      = numeric_limits<double>::max();
+    double eta     = numeric_limits<double>::max();
+    double phi     = numeric_limits<double>::max();
+
+  };  // end SCorrelatorJetTreeMakerTruthCst
+
+
+
+  struct SCorrelatorJetTreeMakerTruthJet {
+
+    unsigned int id   = numeric_limits<unsigned int>::max();
+    double       ene  = numeric_limits<double>::max();
+    double       pt   = numeric_limits<double>::max();
+    double       eta  = numeric_limits<double>::max();
+    double       phi  = numeric_limits<double>::max();
+    double       area = numeric_limits<double>::max();
+
+    vector<SCorrelatorJetTreeMakerTruthCst> csts;
+
+  };  // end SCorrelatorJetTreeMakerTruthJet
+
+
+
   struct SCorrelatorJetTreeMakerTruthOutput {
 
-    /* TODO will go here */
+    // event variables
+    int    nJets     = numeric_limits<int>::max();
+    int    nChrgPars = numeric_limits<int>::max();
+    double eSumPar   = numeric_limits<double>::max();
+    double vtxX      = numeric_limits<double>::max();
+    double vtxY      = numeric_limits<double>::max();
+    double vtxZ      = numeric_limits<double>::max();
+
+    // parton variables
+    pair<int, int>       partonID = {numeric_limits<int>::max(),    numeric_limits<int>::max()};
+    pair<double, double> partonPX = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double> partonPY = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double> partonPZ = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+
+    // jets (and their constituents)
+    vector<SCorrelatorJetTreeMakerTruthJet> jets;
+
+
+
+    void Reset() {
+      nJets     = numeric_limits<int>::max();
+      nChrgPars = numeric_limits<int>::max();
+      eSumPar   = numeric_limits<double>::max();
+      vtxX      = numeric_limits<double>::max();
+      vtxY      = numeric_limits<double>::max();
+      vtxZ      = numeric_limits<double>::max();
+      partonID  = make_pair(numeric_limits<int>::max(),    numeric_limits<int>::max());
+      partonPX  = make_pair(numeric_limits<double>::max(), numeric_limits<double>::max());
+      partonPY  = make_pair(numeric_limits<double>::max(), numeric_limits<double>::max());
+      partonPZ  = make_pair(numeric_limits<double>::max(), numeric_limits<double>::max());
+      jets.clear();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jets.emplace_back();
+      jets.back().id   = id;
+      jets.back().ene  = ene;
+      jets.back().pt   = pt;
+      jets.back().eta  = eta;
+      jets.back().phi  = phi;
+      jets.back().area = area;
+      jets.back().csts.reserve(nCst);
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int id, const int embedID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      jets.back().csts.push_back({id, embedID, z, dr, ene, pt, eta, phi});
+      return;
+    }  // end 'AddCst(int, int, double x 6)'
 
   };  // end SCorrelatorJetTreeMakerTruthOutput
 
 
 
+  struct SCorrelatorJetTreeMakerRecoCst {
+
+    int    matchID = numeric_limits<int>::max();
+    double z       = numeric_limits<double>::max();
+    double dr      = numeric_limits<double>::max();
+    double ene     = numeric_limits<double>::max();
+    double pt      = numeric_limits<double>::max();
+    double eta     = numeric_limits<double>::max();
+    double phi     = numeric_limits<double>::max();
+
+  };  // end SCorrelatorJetTreeMakerRecoCst
+
+
+
+  struct SCorrelatorJetTreeMakerRecoJet {
+
+    unsigned int id   = numeric_limits<unsigned int>::max();
+    double       ene  = numeric_limits<double>::max();
+    double       pt   = numeric_limits<double>::max();
+    double       eta  = numeric_limits<double>::max();
+    double       phi  = numeric_limits<double>::max();
+    double       area = numeric_limits<double>::max();
+
+    vector<SCorrelatorJetTreeMakerRecoCst> csts;
+
+  };  // end SCorrelatorJetTreeMakerRecoJet
+
+
+
   struct SCorrelatorJetTreeMakerRecoOutput {
 
+    // event variables
+    int    nJets    = numeric_limits<int>::max();
+    int    nTrks    = numeric_limits<int>::max();
+    double vtxX     = numeric_limits<double>::max();
+    double vtxY     = numeric_limits<double>::max();
+    double vtxZ     = numeric_limits<double>::max();
+    double eSumECal = numeric_limits<double>::max();
+    double eSumHCal = numeric_limits<double>::max();
+
+    // jets (and their constituents)
+    vector<SCorrelatorJetTreeMakerRecoJet> jets;
+
+
+
+    void Reset() {
+      nJets    = numeric_limits<int>::max();
+      nTrks    = numeric_limits<int>::max();
+      vtxX     = numeric_limits<double>::max();
+      vtxY     = numeric_limits<double>::max();
+      vtxZ     = numeric_limits<double>::max();
+      eSumECal = numeric_limits<double>::max();
+      eSumHCal = numeric_limits<double>::max();
+      jets.clear();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jets.emplace_back();
+      jets.back().id   = id;
+      jets.back().ene  = ene;
+      jets.back().pt   = pt;
+      jets.back().eta  = eta;
+      jets.back().phi  = phi;
+      jets.back().area = area;
+      jets.back().csts.reserve(nCst);
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int matchID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      jets.back().csts.push_back({matchID, z, dr, ene, pt, eta, phi});
+      return;
+    }  // end 'AddCst(int, double x 6)'
+
   };  // end SCorrelatorJetTreeMakerRecoOutput
 
 
 
+  // SCorrelatorJetTreeMakerPrecision definition ------------------------------
+
+  struct SCorrelatorJetTreeMakerPrecision {
+
+    // no. of mantissa bits kept per column when writing kinematics
+    // as floats: 23 keeps full single precision, fewer bits zero out
+    // the rest of the mantissa (like Float16_t) so it compresses away
+    int jetE    = 23;
+    int jetPt   = 23;
+    int jetEta  = 23;
+    int jetPhi  = 23;
+    int jetArea = 23;
+    int cstZ    = 23;
+    int cstDr   = 23;
+    int cstE    = 23;
+    int cstPt   = 23;
+    int cstEta  = 23;
+    int cstPhi  = 23;
+
+
+
+    static float Truncate(const double value, const int nBits) {
+
+      float reduced = (float) value;
+      if (nBits >= 23) return reduced;
+
+      // round to nearest, leaving infinities and nan alone
+      const int nDrop = 23 - max(nBits, 0);
+      uint32_t  bits  = 0;
+      memcpy(&bits, &reduced, sizeof(bits));
+      if ((bits & 0x7f800000) != 0x7f800000) {
+        bits = (bits + (1u << (nDrop - 1))) & ~((1u << nDrop) - 1u);
+      }
+      memcpy(&reduced, &bits, sizeof(bits));
+      return reduced;
+
+    }  // end 'Truncate(double, int)'
+
+  };  // end SCorrelatorJetTreeMakerPrecision
+
+
+
+  // SCorrelatorJetTreeMakerFloatKinematics definition ------------------------
+
+  // Single-precision copies of the jet and constituent kinematics, which
+  // are written in place of the double columns if float output is on.
+  // TCstColumn is vector<float> (flat) or vector<vector<float>> (legacy).
+
+  template <typename TCstColumn> struct SCorrelatorJetTreeMakerFloatKinematics {
+
+    // jet columns
+    vector<float> jetE;
+    vector<float> jetPt;
+    vector<float> jetEta;
+    vector<float> jetPhi;
+    vector<float> jetArea;
+
+    // constituent columns
+    TCstColumn cstZ;
+    TCstColumn cstDr;
+    TCstColumn cstE;
+    TCstColumn cstPt;
+    TCstColumn cstEta;
+    TCstColumn cstPhi;
+
+
+
+    static void ReduceColumn(const vector<double>& column, vector<float>& reduced, const int nBits) {
+      reduced.resize(column.size());
+      for (size_t iVal = 0; iVal < column.size(); iVal++) {
+        reduced[iVal] = SCorrelatorJetTreeMakerPrecision::Truncate(column[iVal], nBits);
+      }
+      return;
+    }  // end 'ReduceColumn(vector<double>&, vector<float>&, int)'
+
+
+
+    static void ReduceColumn(const vector<vector<double>>& column, vector<vector<float>>& reduced, const int nBits) {
+      reduced.resize(column.size());
+      for (size_t iJet = 0; iJet < column.size(); iJet++) {
+        ReduceColumn(column[iJet], reduced[iJet], nBits);
+      }
+      return;
+    }  // end 'ReduceColumn(vector<vector<double>>&, vector<vector<float>>&, int)'
+
+
+
+    template <typename TOutput> void Reduce(const TOutput& output, const SCorrelatorJetTreeMakerPrecision& precision) {
+      ReduceColumn(output.jetE,    jetE,    precision.jetE);
+      ReduceColumn(output.jetPt,   jetPt,   precision.jetPt);
+      ReduceColumn(output.jetEta,  jetEta,  precision.jetEta);
+      ReduceColumn(output.jetPhi,  jetPhi,  precision.jetPhi);
+      ReduceColumn(output.jetArea, jetArea, precision.jetArea);
+      ReduceColumn(output.cstZ,    cstZ,    precision.cstZ);
+      ReduceColumn(output.cstDr,   cstDr,   precision.cstDr);
+      ReduceColumn(output.cstE,    cstE,    precision.cstE);
+      ReduceColumn(output.cstPt,   cstPt,   precision.cstPt);
+      ReduceColumn(output.cstEta,  cstEta,  precision.cstEta);
+      ReduceColumn(output.cstPhi,  cstPhi,  precision.cstPhi);
+      return;
+    }  // end 'Reduce(TOutput&, SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+    void SetJetAddresses(TTree* tree) {
+      tree -> Branch("JetEnergy", &jetE);
+      tree -> Branch("JetPt",     &jetPt);
+      tree -> Branch("JetEta",    &jetEta);
+      tree -> Branch("JetPhi",    &jetPhi);
+      tree -> Branch("JetArea",   &jetArea);
+      return;
+    }  // end 'SetJetAddresses(TTree*)'
+
+
+
+    void SetCstAddresses(TTree* tree) {
+      tree -> Branch("CstZ",      &cstZ);
+      tree -> Branch("CstDr",     &cstDr);
+      tree -> Branch("CstEnergy", &cstE);
+      tree -> Branch("CstPt",     &cstPt);
+      tree -> Branch("CstEta",    &cstEta);
+      tree -> Branch("CstPhi",    &cstPhi);
+      return;
+    }  // end 'SetCstAddresses(TTree*)'
+
+  };  // end SCorrelatorJetTreeMakerFloatKinematics
+
+
+
+  // SCorrelatorJetTreeMakerSubtractedKinematics definition -------------------
+
+  // Background density and subtracted jet/constituent kinematics, which
+  // are written next to the raw ones if background subtraction is on.
+  // TCstColumn is vector<double> (flat) or vector<vector<double>> (legacy).
+
+  template <typename TCstColumn> struct SCorrelatorJetTreeMakerSubtractedKinematics {
+
+    // event variables
+    double rho   = numeric_limits<double>::max();
+    double sigma = numeric_limits<double>::max();
+
+    // jet columns: area-subtracted four-momentum, and pt
+    // of the jet rebuilt from subtracted constituents
+    vector<double> jetE;
+    vector<double> jetPt;
+    vector<double> jetEta;
+    vector<double> jetPhi;
+    vector<double> jetCstPt;
+
+    // constituent columns
+    TCstColumn cstPt;
+
+
+
+    void Reset() {
+      rho   = numeric_limits<double>::max();
+      sigma = numeric_limits<double>::max();
+      jetE.clear();
+      jetPt.clear();
+      jetEta.clear();
+      jetPhi.clear();
+      jetCstPt.clear();
+      cstPt.clear();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void SetTreeAddresses(TTree* tree, const bool doCstSub) {
+      tree -> Branch("EvtRho",       &rho,   "EvtRho/D");
+      tree -> Branch("EvtSigma",     &sigma, "EvtSigma/D");
+      tree -> Branch("JetSubEnergy", &jetE);
+      tree -> Branch("JetSubPt",     &jetPt);
+      tree -> Branch("JetSubEta",    &jetEta);
+      tree -> Branch("JetSubPhi",    &jetPhi);
+      if (doCstSub) {
+        tree -> Branch("JetCstSubPt", &jetCstPt);
+        tree -> Branch("CstSubPt",    &cstPt);
+      }
+      return;
+    }  // end 'SetTreeAddresses(TTree*, bool)'
+
+
+
+    void AddJet(const double ene, const double pt, const double eta, const double phi, const double cstSubPt) {
+      jetE.push_back(ene);
+      jetPt.push_back(pt);
+      jetEta.push_back(eta);
+      jetPhi.push_back(phi);
+      jetCstPt.push_back(cstSubPt);
+      AddJetToColumn(cstPt);
+      return;
+    }  // end 'AddJet(double x 5)'
+
+
+
+    void AddCst(const double pt) {
+      AddCstToColumn(cstPt, pt);
+      return;
+    }  // end 'AddCst(double)'
+
+    private:
+
+      static void AddJetToColumn(vector<double>& column) {return;}
+      static void AddJetToColumn(vector<vector<double>>& column) {column.emplace_back();}
+      static void AddCstToColumn(vector<double>& column, const double value) {column.push_back(value);}
+      static void AddCstToColumn(vector<vector<double>>& column, const double value) {column.back().push_back(value);}
+
+  };  // end SCorrelatorJetTreeMakerSubtractedKinematics
+
+
+
+  // SCorrelatorJetTreeMakerMatchColumns definition ---------------------------
+
+  // Truth-reco jet matches, one entry per jet, which are written
+  // to both reco and truth trees if jet matching is on. IDs index
+  // the jets of the other tree for the same event (-1 if none).
+
+  struct SCorrelatorJetTreeMakerMatchColumns {
+
+    // jet columns
+    vector<int>    jetID;      // closest jet within max. distance
+    vector<double> jetDr;      // distance to it
+    vector<int>    cstJetID;   // jet sharing the most constituent energy
+    vector<double> shareFrac;  // fraction of this jet's energy shared with it
+
+
+
+    void Reset() {
+      jetID.clear();
+      jetDr.clear();
+      cstJetID.clear();
+      shareFrac.clear();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void SetTreeAddresses(TTree* tree) {
+      tree -> Branch("JetMatchID",       &jetID);
+      tree -> Branch("JetMatchDr",       &jetDr);
+      tree -> Branch("JetCstMatchID",    &cstJetID);
+      tree -> Branch("JetSharedEneFrac", &shareFrac);
+      return;
+    }  // end 'SetTreeAddresses(TTree*)'
+
+
+
+    void AddJet(const int id, const double dr, const int cstID, const double frac) {
+      jetID.push_back(id);
+      jetDr.push_back(dr);
+      cstJetID.push_back(cstID);
+      shareFrac.push_back(frac);
+      return;
+    }  // end 'AddJet(int, double, int, double)'
+
+  };  // end SCorrelatorJetTreeMakerMatchColumns
+
+
+
   // SCorrelatorJetTreeMakerLegacyOutput definitions ---------------------------
 
   struct SCorrelatorJetTreeMakerLegacyTruthOutput {
@@ -72,6 +505,12 @@ namespace SColdQcdCorrelatorAnalysis {
     vector<vector<double>> cstEta;
     vector<vector<double>> cstPhi;
 
+    // single-precision copies of the kinematics (only written if requested)
+    SCorrelatorJetTreeMakerFloatKinematics<vector<vector<float>>> floats;
+
+    // truth-reco jet matches (only written if requested)
+    SCorrelatorJetTreeMakerMatchColumns match;
+
 
 
     void Reset() {
@@ -100,12 +539,13 @@ namespace SColdQcdCorrelatorAnalysis {
       cstPt.clear();
       cstEta.clear();
       cstPhi.clear();
+      match.Reset();
       return;
     }  // end 'Reset()'
 
 
 
-    void SetTreeAddresses(TTree* truth) {
+    void SetTreeAddresses(TTree* truth, const bool doFloat = false) {
       truth -> Branch("EvtNumJets",     &nJets,           "EvtNumJets/I");
       truth -> Branch("EvtNumChrgPars", &nChrgPars,       "EvtNumChrgPars/I");
       truth -> Branch("EvtVtxX",        &vtxX,            "EvtVtxX/D");
@@ -122,26 +562,92 @@ namespace SColdQcdCorrelatorAnalysis {
       truth -> Branch("Parton4_MomZ",   &partonPZ.second, "Parton4_MomZ/D");
       truth -> Branch("JetNumCst",      &jetNCst);
       truth -> Branch("JetID",          &jetID);
-      truth -> Branch("JetEnergy",      &jetE);
-      truth -> Branch("JetPt",          &jetPt);
-      truth -> Branch("JetEta",         &jetEta);
-      truth -> Branch("JetPhi",         &jetPhi);
-      truth -> Branch("JetArea",        &jetArea);
+      if (doFloat) {
+        floats.SetJetAddresses(truth);
+      } else {
+        truth -> Branch("JetEnergy",      &jetE);
+        truth -> Branch("JetPt",          &jetPt);
+        truth -> Branch("JetEta",         &jetEta);
+        truth -> Branch("JetPhi",         &jetPhi);
+        truth -> Branch("JetArea",        &jetArea);
+      }
       truth -> Branch("CstID",          &cstID);
       truth -> Branch("CstEmbedID",     &cstEmbedID);
-      truth -> Branch("CstZ",           &cstZ);
-      truth -> Branch("CstDr",          &cstDr);
-      truth -> Branch("CstEnergy",      &cstE);
-      truth -> Branch("CstPt",          &cstPt);
-      truth -> Branch("CstEta",         &cstEta);
-      truth -> Branch("CstPhi",         &cstPhi);
+      if (doFloat) {
+        floats.SetCstAddresses(truth);
+      } else {
+        truth -> Branch("CstZ",           &cstZ);
+        truth -> Branch("CstDr",          &cstDr);
+        truth -> Branch("CstEnergy",      &cstE);
+        truth -> Branch("CstPt",          &cstPt);
+        truth -> Branch("CstEta",         &cstEta);
+        truth -> Branch("CstPhi",         &cstPhi);
+      }
       return;
-    }  // end 'SetTreeAddresses(TTree*)'
+    }  // end 'SetTreeAddresses(TTree*, bool)'
+
+
+
+    void Reduce(const SCorrelatorJetTreeMakerPrecision& precision) {
+      floats.Reduce(*this, precision);
+      return;
+    }  // end 'Reduce(SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jetNCst.push_back(nCst);
+      jetID.push_back(id);
+      jetE.push_back(ene);
+      jetPt.push_back(pt);
+      jetEta.push_back(eta);
+      jetPhi.push_back(phi);
+      jetArea.push_back(area);
+      cstID.emplace_back();
+      cstEmbedID.emplace_back();
+      cstZ.emplace_back();
+      cstDr.emplace_back();
+      cstE.emplace_back();
+      cstPt.emplace_back();
+      cstEta.emplace_back();
+      cstPhi.emplace_back();
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int id, const int embedID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      cstID.back().push_back(id);
+      cstEmbedID.back().push_back(embedID);
+      cstZ.back().push_back(z);
+      cstDr.back().push_back(dr);
+      cstE.back().push_back(ene);
+      cstPt.back().push_back(pt);
+      cstEta.back().push_back(eta);
+      cstPhi.back().push_back(phi);
+      return;
+    }  // end 'AddCst(int, int, double x 6)'
 
 
 
-    void GetTreeMakerOutput(SCorrelatorJetTreeMakerTruthOutput& output) {
-      /* TODO fill in */
+    void GetTreeMakerOutput(SCorrelatorJetTreeMakerTruthOutput& output) const {
+      output.Reset();
+      output.nJets     = nJets;
+      output.nChrgPars = nChrgPars;
+      output.eSumPar   = eSumPar;
+      output.vtxX      = vtxX;
+      output.vtxY      = vtxY;
+      output.vtxZ      = vtxZ;
+      output.partonID  = partonID;
+      output.partonPX  = partonPX;
+      output.partonPY  = partonPY;
+      output.partonPZ  = partonPZ;
+      for (size_t iJet = 0; iJet < jetPt.size(); iJet++) {
+        output.AddJet(jetNCst[iJet], jetID[iJet], jetE[iJet], jetPt[iJet], jetEta[iJet], jetPhi[iJet], jetArea[iJet]);
+        for (size_t iCst = 0; iCst < cstPt[iJet].size(); iCst++) {
+          output.AddCst(cstID[iJet][iCst], cstEmbedID[iJet][iCst], cstZ[iJet][iCst], cstDr[iJet][iCst], cstE[iJet][iCst], cstPt[iJet][iCst], cstEta[iJet][iCst], cstPhi[iJet][iCst]);
+        }
+      }
       return;
     }  // end 'GetTreeMakerOutput(SCorrelatorJetTreeMakerTruthOutput&)'
 
@@ -178,6 +684,15 @@ namespace SColdQcdCorrelatorAnalysis {
     vector<vector<double>> cstEta;
     vector<vector<double>> cstPhi;
 
+    // single-precision copies of the kinematics (only written if requested)
+    SCorrelatorJetTreeMakerFloatKinematics<vector<vector<float>>> floats;
+
+    // background-subtracted kinematics (only written if requested)
+    SCorrelatorJetTreeMakerSubtractedKinematics<vector<vector<double>>> bkgd;
+
+    // truth-reco jet matches (only written if requested)
+    SCorrelatorJetTreeMakerMatchColumns match;
+
 
 
     void Reset() {
@@ -202,45 +717,458 @@ namespace SColdQcdCorrelatorAnalysis {
       cstPt.clear();
       cstEta.clear();
       cstPhi.clear();
+      bkgd.Reset();
+      match.Reset();
       return;
     }  // end 'Reset()'
 
 
 
-    void SetRecoTreeAddressses(TTree* reco) {
+    void SetTreeAddresses(TTree* reco, const bool doFloat = false) {
       reco -> Branch("EvtNumJets",    &nJets,    "EvtNumJets/I");
       reco -> Branch("EvtNumTrks",    &nTrks,    "EvtNumTrks/I");
-      reco -> Branch("EvtVtxX",       &btxX,     "EvtVtxX/D");
-      reco -> Branch("EvtVtxY",       &btxY,     "EvtVtxY/D");
-      reco -> Branch("EvtVtxZ",       &btxZ,     "EvtVtxZ/D");
+      reco -> Branch("EvtVtxX",       &vtxX,     "EvtVtxX/D");
+      reco -> Branch("EvtVtxY",       &vtxY,     "EvtVtxY/D");
+      reco -> Branch("EvtVtxZ",       &vtxZ,     "EvtVtxZ/D");
       reco -> Branch("EvtSumECalEne", &eSumECal, "EvtSumECalEne/D");
       reco -> Branch("EvtSumHCalEne", &eSumHCal, "EvtSumHCalEne/D");
       reco -> Branch("JetNumCst",     &jetNCst);
       reco -> Branch("JetID",         &jetID);
-      reco -> Branch("JetEnergy",     &jetE);
-      reco -> Branch("JetPt",         &jetPt);
-      reco -> Branch("JetEta",        &jetEta);
-      reco -> Branch("JetPhi",        &jetPhi);
-      reco -> Branch("JetArea",       &jetArea);
+      if (doFloat) {
+        floats.SetJetAddresses(reco);
+      } else {
+        reco -> Branch("JetEnergy",     &jetE);
+        reco -> Branch("JetPt",         &jetPt);
+        reco -> Branch("JetEta",        &jetEta);
+        reco -> Branch("JetPhi",        &jetPhi);
+        reco -> Branch("JetArea",       &jetArea);
+      }
       reco -> Branch("CstMatchID",    &cstMatchID);
-      reco -> Branch("CstZ",          &cstZ);
-      reco -> Branch("CstDr",         &cstDr);
-      reco -> Branch("CstEnergy",     &cstE);
-      reco -> Branch("CstPt",         &cstPt);
-      reco -> Branch("CstEta",        &cstEta);
-      reco -> Branch("CstPhi",        &cstPhi);
+      if (doFloat) {
+        floats.SetCstAddresses(reco);
+      } else {
+        reco -> Branch("CstZ",          &cstZ);
+        reco -> Branch("CstDr",         &cstDr);
+        reco -> Branch("CstEnergy",     &cstE);
+        reco -> Branch("CstPt",         &cstPt);
+        reco -> Branch("CstEta",        &cstEta);
+        reco -> Branch("CstPhi",        &cstPhi);
+      }
       return;
-    }  // end 'SetRecoTreeAddresses(TTree*)'
+    }  // end 'SetTreeAddresses(TTree*, bool)'
 
 
 
-    void GetTreeMakerOutput(SCorrelatorJetTreeMakerRecoOutput& output) {
-      /* TODO fill in */
+    void Reduce(const SCorrelatorJetTreeMakerPrecision& precision) {
+      floats.Reduce(*this, precision);
+      return;
+    }  // end 'Reduce(SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jetNCst.push_back(nCst);
+      jetID.push_back(id);
+      jetE.push_back(ene);
+      jetPt.push_back(pt);
+      jetEta.push_back(eta);
+      jetPhi.push_back(phi);
+      jetArea.push_back(area);
+      cstMatchID.emplace_back();
+      cstZ.emplace_back();
+      cstDr.emplace_back();
+      cstE.emplace_back();
+      cstPt.emplace_back();
+      cstEta.emplace_back();
+      cstPhi.emplace_back();
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int matchID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      cstMatchID.back().push_back(matchID);
+      cstZ.back().push_back(z);
+      cstDr.back().push_back(dr);
+      cstE.back().push_back(ene);
+      cstPt.back().push_back(pt);
+      cstEta.back().push_back(eta);
+      cstPhi.back().push_back(phi);
+      return;
+    }  // end 'AddCst(int, double x 6)'
+
+
+
+    void GetTreeMakerOutput(SCorrelatorJetTreeMakerRecoOutput& output) const {
+      output.Reset();
+      output.nJets    = nJets;
+      output.nTrks    = nTrks;
+      output.vtxX     = vtxX;
+      output.vtxY     = vtxY;
+      output.vtxZ     = vtxZ;
+      output.eSumECal = eSumECal;
+      output.eSumHCal = eSumHCal;
+      for (size_t iJet = 0; iJet < jetPt.size(); iJet++) {
+        output.AddJet(jetNCst[iJet], jetID[iJet], jetE[iJet], jetPt[iJet], jetEta[iJet], jetPhi[iJet], jetArea[iJet]);
+        for (size_t iCst = 0; iCst < cstPt[iJet].size(); iCst++) {
+          output.AddCst(cstMatchID[iJet][iCst], cstZ[iJet][iCst], cstDr[iJet][iCst], cstE[iJet][iCst], cstPt[iJet][iCst], cstEta[iJet][iCst], cstPhi[iJet][iCst]);
+        }
+      }
       return;
     }  // end 'GetTreeMakerOutput(SCorrelatorJetTreeMakerRecoOutput&)'
 
   };  // end SCorrelatorJetTreeMakerLegacyOutput
 
+
+
+  // SCorrelatorJetTreeMakerFlatOutput definitions -----------------------------
+
+  // In the flat layout, constituents of all jets in an event are
+  // stored back-to-back in contiguous columns. The constituents of
+  // jet i are found at [jetCstOffset[i], jetCstOffset[i] + jetNCst[i]).
+
+  struct SCorrelatorJetTreeMakerFlatTruthOutput {
+
+    // output truth tree event variables
+    int    nJets     = numeric_limits<int>::max();
+    int    nChrgPars = numeric_limits<int>::max();
+    double eSumPar   = numeric_limits<double>::max();
+    double vtxX      = numeric_limits<double>::max();
+    double vtxY      = numeric_limits<double>::max();
+    double vtxZ      = numeric_limits<double>::max();
+
+    // output truth tree parton variables
+    pair<int, int>        partonID = {numeric_limits<int>::max(),    numeric_limits<int>::max()};
+    pair<double, double>  partonPX = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double>  partonPY = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double>  partonPZ = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+
+    // output truth tree jet variables
+    vector<unsigned long> jetNCst;
+    vector<unsigned long> jetCstOffset;
+    vector<unsigned int>  jetID;
+    vector<double>        jetE;
+    vector<double>        jetPt;
+    vector<double>        jetEta;
+    vector<double>        jetPhi;
+    vector<double>        jetArea;
+
+    // output truth tree constituent variables
+    vector<int>    cstID;
+    vector<int>    cstEmbedID;
+    vector<double> cstZ;
+    vector<double> cstDr;
+    vector<double> cstE;
+    vector<double> cstPt;
+    vector<double> cstEta;
+    vector<double> cstPhi;
+
+    // single-precision copies of the kinematics (only written if requested)
+    SCorrelatorJetTreeMakerFloatKinematics<vector<float>> floats;
+
+    // truth-reco jet matches (only written if requested)
+    SCorrelatorJetTreeMakerMatchColumns match;
+
+
+
+    void Reset() {
+      nJets     = numeric_limits<int>::max();
+      nChrgPars = numeric_limits<int>::max();
+      eSumPar   = numeric_limits<double>::max();
+      vtxX      = numeric_limits<double>::max();
+      vtxY      = numeric_limits<double>::max();
+      vtxZ      = numeric_limits<double>::max();
+      partonID  = make_pair(numeric_limits<int>::max(), numeric_limits<int>::max());
+      partonPX  = make_pair(numeric_limits<int>::max(), numeric_limits<int>::max());
+      partonPY  = make_pair(numeric_limits<int>::max(), numeric_limits<int>::max());
+      partonPZ  = make_pair(numeric_limits<int>::max(), numeric_limits<int>::max());
+      jetNCst.clear();
+      jetCstOffset.clear();
+      jetID.clear();
+      jetE.clear();
+      jetPt.clear();
+      jetEta.clear();
+      jetPhi.clear();
+      jetArea.clear();
+      cstID.clear();
+      cstEmbedID.clear();
+      cstZ.clear();
+      cstDr.clear();
+      cstE.clear();
+      cstPt.clear();
+      cstEta.clear();
+      cstPhi.clear();
+      match.Reset();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void SetTreeAddresses(TTree* truth, const bool doFloat = false) {
+      truth -> Branch("EvtNumJets",     &nJets,           "EvtNumJets/I");
+      truth -> Branch("EvtNumChrgPars", &nChrgPars,       "EvtNumChrgPars/I");
+      truth -> Branch("EvtVtxX",        &vtxX,            "EvtVtxX/D");
+      truth -> Branch("EvtVtxY",        &vtxY,            "EvtVtxY/D");
+      truth -> Branch("EvtVtxZ",        &vtxZ,            "EvtVtxZ/D");
+      truth -> Branch("EvtSumParEne",   &eSumPar,         "EvtSumParEne/D");
+      truth -> Branch("Parton3_ID",     &partonID.first,  "Parton3_ID/I");
+      truth -> Branch("Parton4_ID",     &partonID.second, "Parton4_ID/I");
+      truth -> Branch("Parton3_MomX",   &partonPX.first,  "Parton3_MomX/D");
+      truth -> Branch("Parton3_MomY",   &partonPY.first,  "Parton3_MomY/D");
+      truth -> Branch("Parton3_MomZ",   &partonPZ.first,  "Parton3_MomZ/D");
+      truth -> Branch("Parton4_MomX",   &partonPX.second, "Parton4_MomX/D");
+      truth -> Branch("Parton4_MomY",   &partonPY.second, "Parton4_MomY/D");
+      truth -> Branch("Parton4_MomZ",   &partonPZ.second, "Parton4_MomZ/D");
+      truth -> Branch("JetNumCst",      &jetNCst);
+      truth -> Branch("JetCstOffset",   &jetCstOffset);
+      truth -> Branch("JetID",          &jetID);
+      if (doFloat) {
+        floats.SetJetAddresses(truth);
+      } else {
+        truth -> Branch("JetEnergy",      &jetE);
+        truth -> Branch("JetPt",          &jetPt);
+        truth -> Branch("JetEta",         &jetEta);
+        truth -> Branch("JetPhi",         &jetPhi);
+        truth -> Branch("JetArea",        &jetArea);
+      }
+      truth -> Branch("CstID",          &cstID);
+      truth -> Branch("CstEmbedID",     &cstEmbedID);
+      if (doFloat) {
+        floats.SetCstAddresses(truth);
+      } else {
+        truth -> Branch("CstZ",           &cstZ);
+        truth -> Branch("CstDr",          &cstDr);
+        truth -> Branch("CstEnergy",      &cstE);
+        truth -> Branch("CstPt",          &cstPt);
+        truth -> Branch("CstEta",         &cstEta);
+        truth -> Branch("CstPhi",         &cstPhi);
+      }
+      return;
+    }  // end 'SetTreeAddresses(TTree*, bool)'
+
+
+
+    void Reduce(const SCorrelatorJetTreeMakerPrecision& precision) {
+      floats.Reduce(*this, precision);
+      return;
+    }  // end 'Reduce(SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jetNCst.push_back(nCst);
+      jetCstOffset.push_back(cstPt.size());
+      jetID.push_back(id);
+      jetE.push_back(ene);
+      jetPt.push_back(pt);
+      jetEta.push_back(eta);
+      jetPhi.push_back(phi);
+      jetArea.push_back(area);
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int id, const int embedID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      cstID.push_back(id);
+      cstEmbedID.push_back(embedID);
+      cstZ.push_back(z);
+      cstDr.push_back(dr);
+      cstE.push_back(ene);
+      cstPt.push_back(pt);
+      cstEta.push_back(eta);
+      cstPhi.push_back(phi);
+      return;
+    }  // end 'AddCst(int, int, double x 6)'
+
+
+
+    void GetTreeMakerOutput(SCorrelatorJetTreeMakerTruthOutput& output) const {
+      output.Reset();
+      output.nJets     = nJets;
+      output.nChrgPars = nChrgPars;
+      output.eSumPar   = eSumPar;
+      output.vtxX      = vtxX;
+      output.vtxY      = vtxY;
+      output.vtxZ      = vtxZ;
+      output.partonID  = partonID;
+      output.partonPX  = partonPX;
+      output.partonPY  = partonPY;
+      output.partonPZ  = partonPZ;
+      for (size_t iJet = 0; iJet < jetPt.size(); iJet++) {
+        output.AddJet(jetNCst[iJet], jetID[iJet], jetE[iJet], jetPt[iJet], jetEta[iJet], jetPhi[iJet], jetArea[iJet]);
+        for (size_t iCst = jetCstOffset[iJet]; iCst < jetCstOffset[iJet] + jetNCst[iJet]; iCst++) {
+          output.AddCst(cstID[iCst], cstEmbedID[iCst], cstZ[iCst], cstDr[iCst], cstE[iCst], cstPt[iCst], cstEta[iCst], cstPhi[iCst]);
+        }
+      }
+      return;
+    }  // end 'GetTreeMakerOutput(SCorrelatorJetTreeMakerTruthOutput&)'
+
+  };  // end SCorrelatorJetTreeMakerFlatTruthOutput
+
+
+
+  struct SCorrelatorJetTreeMakerFlatRecoOutput {
+
+    // output reco tree event variables
+    int    nJets    = numeric_limits<int>::max();
+    int    nTrks    = numeric_limits<int>::max();
+    double vtxX     = numeric_limits<double>::max();
+    double vtxY     = numeric_limits<double>::max();
+    double vtxZ     = numeric_limits<double>::max();
+    double eSumECal = numeric_limits<double>::max();
+    double eSumHCal = numeric_limits<double>::max();
+
+    // output reco tree jet variables
+    vector<unsigned long> jetNCst;
+    vector<unsigned long> jetCstOffset;
+    vector<unsigned int>  jetID;
+    vector<double>        jetE;
+    vector<double>        jetPt;
+    vector<double>        jetEta;
+    vector<double>        jetPhi;
+    vector<double>        jetArea;
+
+    // output reco tree constituent variables
+    vector<int>    cstMatchID;
+    vector<double> cstZ;
+    vector<double> cstDr;
+    vector<double> cstE;
+    vector<double> cstPt;
+    vector<double> cstEta;
+    vector<double> cstPhi;
+
+    // single-precision copies of the kinematics (only written if requested)
+    SCorrelatorJetTreeMakerFloatKinematics<vector<float>> floats;
+
+    // background-subtracted kinematics (only written if requested)
+    SCorrelatorJetTreeMakerSubtractedKinematics<vector<double>> bkgd;
+
+    // truth-reco jet matches (only written if requested)
+    SCorrelatorJetTreeMakerMatchColumns match;
+
+
+
+    void Reset() {
+      nJets    = numeric_limits<int>::max();
+      nTrks    = numeric_limits<int>::max();
+      vtxX     = numeric_limits<double>::max();
+      vtxY     = numeric_limits<double>::max();
+      vtxZ     = numeric_limits<double>::max();
+      eSumECal = numeric_limits<double>::max();
+      eSumHCal = numeric_limits<double>::max();
+      jetNCst.clear();
+      jetCstOffset.clear();
+      jetID.clear();
+      jetE.clear();
+      jetPt.clear();
+      jetEta.clear();
+      jetPhi.clear();
+      jetArea.clear();
+      cstMatchID.clear();
+      cstZ.clear();
+      cstDr.clear();
+      cstE.clear();
+      cstPt.clear();
+      cstEta.clear();
+      cstPhi.clear();
+      bkgd.Reset();
+      match.Reset();
+      return;
+    }  // end 'Reset()'
+
+
+
+    void SetTreeAddresses(TTree* reco, const bool doFloat = false) {
+      reco -> Branch("EvtNumJets",    &nJets,    "EvtNumJets/I");
+      reco -> Branch("EvtNumTrks",    &nTrks,    "EvtNumTrks/I");
+      reco -> Branch("EvtVtxX",       &vtxX,     "EvtVtxX/D");
+      reco -> Branch("EvtVtxY",       &vtxY,     "EvtVtxY/D");
+      reco -> Branch("EvtVtxZ",       &vtxZ,     "EvtVtxZ/D");
+      reco -> Branch("EvtSumECalEne", &eSumECal, "EvtSumECalEne/D");
+      reco -> Branch("EvtSumHCalEne", &eSumHCal, "EvtSumHCalEne/D");
+      reco -> Branch("JetNumCst",     &jetNCst);
+      reco -> Branch("JetCstOffset",  &jetCstOffset);
+      reco -> Branch("JetID",         &jetID);
+      if (doFloat) {
+        floats.SetJetAddresses(reco);
+      } else {
+        reco -> Branch("JetEnergy",     &jetE);
+        reco -> Branch("JetPt",         &jetPt);
+        reco -> Branch("JetEta",        &jetEta);
+        reco -> Branch("JetPhi",        &jetPhi);
+        reco -> Branch("JetArea",       &jetArea);
+      }
+      reco -> Branch("CstMatchID",    &cstMatchID);
+      if (doFloat) {
+        floats.SetCstAddresses(reco);
+      } else {
+        reco -> Branch("CstZ",          &cstZ);
+        reco -> Branch("CstDr",         &cstDr);
+        reco -> Branch("CstEnergy",     &cstE);
+        reco -> Branch("CstPt",         &cstPt);
+        reco -> Branch("CstEta",        &cstEta);
+        reco -> Branch("CstPhi",        &cstPhi);
+      }
+      return;
+    }  // end 'SetTreeAddresses(TTree*, bool)'
+
+
+
+    void Reduce(const SCorrelatorJetTreeMakerPrecision& precision) {
+      floats.Reduce(*this, precision);
+      return;
+    }  // end 'Reduce(SCorrelatorJetTreeMakerPrecision&)'
+
+
+
+    void AddJet(const unsigned long nCst, const unsigned int id, const double ene, const double pt, const double eta, const double phi, const double area) {
+      jetNCst.push_back(nCst);
+      jetCstOffset.push_back(cstPt.size());
+      jetID.push_back(id);
+      jetE.push_back(ene);
+      jetPt.push_back(pt);
+      jetEta.push_back(eta);
+      jetPhi.push_back(phi);
+      jetArea.push_back(area);
+      return;
+    }  // end 'AddJet(unsigned long, unsigned int, double x 5)'
+
+
+
+    void AddCst(const int matchID, const double z, const double dr, const double ene, const double pt, const double eta, const double phi) {
+      cstMatchID.push_back(matchID);
+      cstZ.push_back(z);
+      cstDr.push_back(dr);
+      cstE.push_back(ene);
+      cstPt.push_back(pt);
+      cstEta.push_back(eta);
+      cstPhi.push_back(phi);
+      return;
+    }  // end 'AddCst(int, double x 6)'
+
+
+
+    void GetTreeMakerOutput(SCorrelatorJetTreeMakerRecoOutput& output) const {
+      output.Reset();
+      output.nJets    = nJets;
+      output.nTrks    = nTrks;
+      output.vtxX     = vtxX;
+      output.vtxY     = vtxY;
+      output.vtxZ     = vtxZ;
+      output.eSumECal = eSumECal;
+      output.eSumHCal = eSumHCal;
+      for (size_t iJet = 0; iJet < jetPt.size(); iJet++) {
+        output.AddJet(jetNCst[iJet], jetID[iJet], jetE[iJet], jetPt[iJet], jetEta[iJet], jetPhi[iJet], jetArea[iJet]);
+        for (size_t iCst = jetCstOffset[iJet]; iCst < jetCstOffset[iJet] + jetNCst[iJet]; iCst++) {
+          output.AddCst(cstMatchID[iCst], cstZ[iCst], cstDr[iCst], cstE[iCst], cstPt[iCst], cstEta[iCst], cstPhi[iCst]);
+        }
+      }
+      return;
+    }  // end 'GetTreeMakerOutput(SCorrelatorJetTreeMakerRecoOutput&)'
+
+  };  // end SCorrelatorJetTreeMakerFlatRecoOutput
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 #endif
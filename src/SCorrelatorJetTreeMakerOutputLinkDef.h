@@ -0,0 +1,28 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerOutputLinkDef'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifdef __CINT__
+
+// event model written by the rntuple backend
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerRecoCst+;
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerRecoJet+;
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerRecoOutput+;
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerTruthCst+;
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerTruthJet+;
+#pragma link C++ class SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerTruthOutput+;
+#pragma link C++ class std::vector<SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerRecoCst>+;
+#pragma link C++ class std::vector<SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerRecoJet>+;
+#pragma link C++ class std::vector<SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerTruthCst>+;
+#pragma link C++ class std::vector<SColdQcdCorrelatorAnalysis::SCorrelatorJetTreeMakerTruthJet>+;
+
+#endif
+
+// end ------------------------------------------------------------------------
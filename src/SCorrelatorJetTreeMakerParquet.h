@@ -0,0 +1,360 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerParquet.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERPARQUET_H
+#define SCORRELATORJETTREEMAKERPARQUET_H
+
+// c++ utilities
+#include <memory>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+// arrow/parquet libraries (only if configured with --enable-parquet)
+#ifdef SCORRELATOR_USE_PARQUET
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <parquet/properties.h>
+#include <parquet/arrow/writer.h>
+#endif
+// analysis definitions
+#include "SCorrelatorJetTreeMakerOutput.h"
+#include "SCorrelatorJetTreeMakerWriteConfig.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerParquetTable definition ---------------------------
+
+  // One parquet file: rows are appended column by column into arrow
+  // builders, and every 'rowGroupSize' rows the builders are turned
+  // into a record batch and written out as one row group.
+
+  class SCorrelatorJetTreeMakerParquetTable {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerParquetTable(const string& fileName, const vector<string>& intColumns, const vector<string>& doubleColumns, const int64_t rowGroupSize, const SCorrelatorJetTreeMakerWriteConfig& config) {
+
+        m_fileName     = fileName;
+        m_rowGroupSize = (rowGroupSize > 0) ? rowGroupSize : 1;
+#ifdef SCORRELATOR_USE_PARQUET
+        // integer columns first, then floating-point ones
+        vector<shared_ptr<arrow::Field>> fields;
+        for (const string& column : intColumns) {
+          fields.push_back(arrow::field(column, arrow::int64()));
+          m_intBuilders.push_back(make_shared<arrow::Int64Builder>());
+        }
+        for (const string& column : doubleColumns) {
+          fields.push_back(arrow::field(column, arrow::float64()));
+          m_doubleBuilders.push_back(make_shared<arrow::DoubleBuilder>());
+        }
+        m_schema = arrow::schema(fields);
+
+        // open file and writer
+        arrow::Result<shared_ptr<arrow::io::FileOutputStream>> file = arrow::io::FileOutputStream::Open(m_fileName);
+        Check(file.status(), "opening file");
+        m_file = *file;
+
+        shared_ptr<parquet::WriterProperties> properties = parquet::WriterProperties::Builder().compression(GetCompression(config)) -> build();
+        arrow::Result<unique_ptr<parquet::arrow::FileWriter>> writer = parquet::arrow::FileWriter::Open(*m_schema, arrow::default_memory_pool(), m_file, properties);
+        Check(writer.status(), "opening writer");
+        m_writer = move(*writer);
+#endif
+
+      }  // end ctor(string&, vector<string>&, vector<string>&, int64_t, SCorrelatorJetTreeMakerWriteConfig&)
+
+      ~SCorrelatorJetTreeMakerParquetTable() {
+        Close();
+      };
+
+
+
+      void AppendInt(const size_t iColumn, const int64_t value) {
+#ifdef SCORRELATOR_USE_PARQUET
+        Check(m_intBuilders[iColumn] -> Append(value), "appending");
+#endif
+        return;
+      }  // end 'AppendInt(size_t, int64_t)'
+
+
+
+      void AppendDouble(const size_t iColumn, const double value) {
+#ifdef SCORRELATOR_USE_PARQUET
+        Check(m_doubleBuilders[iColumn] -> Append(value), "appending");
+#endif
+        return;
+      }  // end 'AppendDouble(size_t, double)'
+
+
+
+      void EndRow() {
+        if (++m_nRows >= m_rowGroupSize) {
+          Flush();
+        }
+        return;
+      }  // end 'EndRow()'
+
+
+
+      void Flush() {
+
+        if (m_nRows == 0) return;
+#ifdef SCORRELATOR_USE_PARQUET
+        vector<shared_ptr<arrow::Array>> arrays;
+        for (shared_ptr<arrow::Int64Builder>& builder : m_intBuilders) {
+          shared_ptr<arrow::Array> array;
+          Check(builder -> Finish(&array), "finishing column");
+          arrays.push_back(array);
+        }
+        for (shared_ptr<arrow::DoubleBuilder>& builder : m_doubleBuilders) {
+          shared_ptr<arrow::Array> array;
+          Check(builder -> Finish(&array), "finishing column");
+          arrays.push_back(array);
+        }
+
+        // chunk size = no. of rows, so each flush is one row group
+        shared_ptr<arrow::Table> table = arrow::Table::Make(m_schema, arrays, m_nRows);
+        Check(m_writer -> WriteTable(*table, m_nRows), "writing row group");
+#endif
+        m_nRows = 0;
+        return;
+
+      }  // end 'Flush()'
+
+
+
+      void Close() {
+
+        if (m_isClosed) return;
+        Flush();
+#ifdef SCORRELATOR_USE_PARQUET
+        Check(m_writer -> Close(), "closing writer");
+        Check(m_file -> Close(),   "closing file");
+#endif
+        m_isClosed = true;
+        return;
+
+      }  // end 'Close()'
+
+    private:
+
+#ifdef SCORRELATOR_USE_PARQUET
+      void Check(const arrow::Status& status, const string& what) const {
+        if (!status.ok()) {
+          cerr << "PANIC: arrow error while " << what << " '" << m_fileName << "': " << status.ToString() << endl;
+          assert(status.ok());
+        }
+        return;
+      }  // end 'Check(arrow::Status&, string&)'
+
+
+
+      static parquet::Compression::type GetCompression(const SCorrelatorJetTreeMakerWriteConfig& config) {
+
+        // follow the tree compression where parquet has an equivalent
+        switch (config.compAlgo) {
+          case SCorrelatorJetTreeMakerWriteConfig::COMP::ZLIB:
+            return parquet::Compression::GZIP;
+          case SCorrelatorJetTreeMakerWriteConfig::COMP::LZ4:
+            return parquet::Compression::LZ4;
+          case SCorrelatorJetTreeMakerWriteConfig::COMP::ZSTD:
+          case SCorrelatorJetTreeMakerWriteConfig::COMP::LZMA:
+            return parquet::Compression::ZSTD;
+          default:
+            return parquet::Compression::SNAPPY;
+        }
+
+      }  // end 'GetCompression(SCorrelatorJetTreeMakerWriteConfig&)'
+
+      // arrow/parquet members
+      shared_ptr<arrow::Schema>                    m_schema;
+      shared_ptr<arrow::io::FileOutputStream>      m_file;
+      unique_ptr<parquet::arrow::FileWriter>       m_writer;
+      vector<shared_ptr<arrow::Int64Builder>>      m_intBuilders;
+      vector<shared_ptr<arrow::DoubleBuilder>>     m_doubleBuilders;
+#endif
+
+      // members
+      bool    m_isClosed     = false;
+      int64_t m_nRows        = 0;
+      int64_t m_rowGroupSize = 65536;
+      string  m_fileName     = "";
+
+  };  // end SCorrelatorJetTreeMakerParquetTable
+
+
+
+  // SCorrelatorJetTreeMakerParquetSink definition ----------------------------
+
+  // Writes one event-model struct (SCorrelatorJetTreeMakerRecoOutput or
+  // SCorrelatorJetTreeMakerTruthOutput) per event as rows of three tables
+  // ('<base>_events.parquet', '<base>_jets.parquet', '<base>_csts.parquet').
+  // Events are keyed by 'evtID' (position in output), jets by ('evtID',
+  // 'jetID'), and constituents carry the key of their jet.
+
+  template <typename TEvent> class SCorrelatorJetTreeMakerParquetSink {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerParquetSink(const string& baseName, const int64_t rowGroupSize, const SCorrelatorJetTreeMakerWriteConfig& config) {
+
+#ifndef SCORRELATOR_USE_PARQUET
+        cerr << "WARNING: parquet output requested for '" << baseName << "' but module was built without --enable-parquet! Nothing will be written." << endl;
+#endif
+
+        const bool isTruth = is_same<TEvent, SCorrelatorJetTreeMakerTruthOutput>::value;
+        const vector<string> evtInts    = isTruth ? vector<string>({"evtID", "nJets", "nChrgPars", "parton3ID", "parton4ID"}) : vector<string>({"evtID", "nJets", "nTrks"});
+        const vector<string> evtDoubles = isTruth ? vector<string>({"vtxX", "vtxY", "vtxZ", "eSumPar", "parton3PX", "parton3PY", "parton3PZ", "parton4PX", "parton4PY", "parton4PZ"}) : vector<string>({"vtxX", "vtxY", "vtxZ", "eSumECal", "eSumHCal"});
+        const vector<string> cstInts    = isTruth ? vector<string>({"evtID", "jetID", "cstID", "embedID"}) : vector<string>({"evtID", "jetID", "matchID"});
+
+        m_events.reset(new SCorrelatorJetTreeMakerParquetTable(baseName + "_events.parquet", evtInts, evtDoubles, rowGroupSize, config));
+        m_jets.reset(new SCorrelatorJetTreeMakerParquetTable(baseName + "_jets.parquet", {"evtID", "jetID", "nCst"}, {"ene", "pt", "eta", "phi", "area"}, rowGroupSize, config));
+        m_csts.reset(new SCorrelatorJetTreeMakerParquetTable(baseName + "_csts.parquet", cstInts, {"z", "dr", "ene", "pt", "eta", "phi"}, rowGroupSize, config));
+
+      }  // end ctor(string&, int64_t, SCorrelatorJetTreeMakerWriteConfig&)
+
+      ~SCorrelatorJetTreeMakerParquetSink() {};
+
+      // getters
+      TEvent& GetEvent() {return m_event;}
+
+
+
+      void Fill() {
+        Write(m_event);
+        return;
+      }  // end 'Fill()'
+
+
+
+      void Write(const SCorrelatorJetTreeMakerRecoOutput& event) {
+
+        m_events -> AppendInt(0, m_nEvents);
+        m_events -> AppendInt(1, event.nJets);
+        m_events -> AppendInt(2, event.nTrks);
+        m_events -> AppendDouble(0, event.vtxX);
+        m_events -> AppendDouble(1, event.vtxY);
+        m_events -> AppendDouble(2, event.vtxZ);
+        m_events -> AppendDouble(3, event.eSumECal);
+        m_events -> AppendDouble(4, event.eSumHCal);
+        m_events -> EndRow();
+
+        for (const SCorrelatorJetTreeMakerRecoJet& jet : event.jets) {
+          WriteJet(jet);
+          for (const SCorrelatorJetTreeMakerRecoCst& cst : jet.csts) {
+            m_csts -> AppendInt(0, m_nEvents);
+            m_csts -> AppendInt(1, jet.id);
+            m_csts -> AppendInt(2, cst.matchID);
+            WriteCst(cst);
+          }
+        }
+        ++m_nEvents;
+        return;
+
+      }  // end 'Write(SCorrelatorJetTreeMakerRecoOutput&)'
+
+
+
+      void Write(const SCorrelatorJetTreeMakerTruthOutput& event) {
+
+        m_events -> AppendInt(0, m_nEvents);
+        m_events -> AppendInt(1, event.nJets);
+        m_events -> AppendInt(2, event.nChrgPars);
+        m_events -> AppendInt(3, event.partonID.first);
+        m_events -> AppendInt(4, event.partonID.second);
+        m_events -> AppendDouble(0, event.vtxX);
+        m_events -> AppendDouble(1, event.vtxY);
+        m_events -> AppendDouble(2, event.vtxZ);
+        m_events -> AppendDouble(3, event.eSumPar);
+        m_events -> AppendDouble(4, event.partonPX.first);
+        m_events -> AppendDouble(5, event.partonPY.first);
+        m_events -> AppendDouble(6, event.partonPZ.first);
+        m_events -> AppendDouble(7, event.partonPX.second);
+        m_events -> AppendDouble(8, event.partonPY.second);
+        m_events -> AppendDouble(9, event.partonPZ.second);
+        m_events -> EndRow();
+
+        for (const SCorrelatorJetTreeMakerTruthJet& jet : event.jets) {
+          WriteJet(jet);
+          for (const SCorrelatorJetTreeMakerTruthCst& cst : jet.csts) {
+            m_csts -> AppendInt(0, m_nEvents);
+            m_csts -> AppendInt(1, jet.id);
+            m_csts -> AppendInt(2, cst.id);
+            m_csts -> AppendInt(3, cst.embedID);
+            WriteCst(cst);
+          }
+        }
+        ++m_nEvents;
+        return;
+
+      }  // end 'Write(SCorrelatorJetTreeMakerTruthOutput&)'
+
+
+
+      void Close() {
+        m_events -> Close();
+        m_jets   -> Close();
+        m_csts   -> Close();
+        return;
+      }  // end 'Close()'
+
+    private:
+
+      template <typename TJet> void WriteJet(const TJet& jet) {
+        m_jets -> AppendInt(0, m_nEvents);
+        m_jets -> AppendInt(1, jet.id);
+        m_jets -> AppendInt(2, jet.csts.size());
+        m_jets -> AppendDouble(0, jet.ene);
+        m_jets -> AppendDouble(1, jet.pt);
+        m_jets -> AppendDouble(2, jet.eta);
+        m_jets -> AppendDouble(3, jet.phi);
+        m_jets -> AppendDouble(4, jet.area);
+        m_jets -> EndRow();
+        return;
+      }  // end 'WriteJet(TJet&)'
+
+
+
+      // key columns are appended by the caller
+      template <typename TCst> void WriteCst(const TCst& cst) {
+        m_csts -> AppendDouble(0, cst.z);
+        m_csts -> AppendDouble(1, cst.dr);
+        m_csts -> AppendDouble(2, cst.ene);
+        m_csts -> AppendDouble(3, cst.pt);
+        m_csts -> AppendDouble(4, cst.eta);
+        m_csts -> AppendDouble(5, cst.phi);
+        m_csts -> EndRow();
+        return;
+      }  // end 'WriteCst(TCst&)'
+
+      // members
+      TEvent                                          m_event;
+      int64_t                                         m_nEvents = 0;
+      unique_ptr<SCorrelatorJetTreeMakerParquetTable> m_events;
+      unique_ptr<SCorrelatorJetTreeMakerParquetTable> m_jets;
+      unique_ptr<SCorrelatorJetTreeMakerParquetTable> m_csts;
+
+  };  // end SCorrelatorJetTreeMakerParquetSink
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
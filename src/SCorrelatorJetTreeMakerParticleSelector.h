@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerParticleSelector.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERPARTICLESELECTOR_H
+#define SCORRELATORJETTREEMAKERPARTICLESELECTOR_H
+
+// c++ utilities
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerParticleTable.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerParticleCuts definition ---------------------------
+
+  struct SCorrelatorJetTreeMakerParticleCuts {
+
+    // neutral particles are dropped for charged jets
+    bool doChargeCut = true;
+
+    // ranges
+    pair<double, double> ptRange  = {0.1,  9999.};
+    pair<double, double> etaRange = {-1.1, 1.1};
+
+  };  // end SCorrelatorJetTreeMakerParticleCuts
+
+
+
+  // SCorrelatorJetTreeMakerParticleSelector definition -----------------------
+
+  class SCorrelatorJetTreeMakerParticleSelector {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerParticleSelector() {};
+      SCorrelatorJetTreeMakerParticleSelector(const SCorrelatorJetTreeMakerParticleCuts& cuts) : m_cuts(cuts) {};
+      ~SCorrelatorJetTreeMakerParticleSelector() {};
+
+      // setters
+      void SetCuts(const SCorrelatorJetTreeMakerParticleCuts& cuts) {m_cuts = cuts;}
+
+      // getters
+      size_t                                     GetNAccepted() const {return m_nAccept;}
+      const SCorrelatorJetTreeMakerParticleCuts& GetCuts()      const {return m_cuts;}
+
+      bool IsAccepted(const size_t iPar) const {
+        return m_pass[iPar];
+      }
+
+
+
+      void Select(const SCorrelatorJetTreeMakerParticleTable& table) {
+
+        // cuts are ANDed into the work buffer without
+        // branching, as in the track selector
+        const size_t  nPar  = table.Size();
+        const double  ptLo  = m_cuts.ptRange.first;
+        const double  ptHi  = m_cuts.ptRange.second;
+        const double  etaLo = m_cuts.etaRange.first;
+        const double  etaHi = m_cuts.etaRange.second;
+        const double* pt    = table.pt.data();
+        const double* eta   = table.eta.data();
+        const float*  chrg  = table.charge.data();
+
+        m_pass.assign(nPar, 1);
+        uint8_t* pass = m_pass.data();
+        for (size_t iPar = 0; iPar < nPar; iPar++) {
+          pass[iPar] &= ((pt[iPar]  > ptLo)  & (pt[iPar]  < ptHi));
+          pass[iPar] &= ((eta[iPar] > etaLo) & (eta[iPar] < etaHi));
+        }
+        if (m_cuts.doChargeCut) {
+          for (size_t iPar = 0; iPar < nPar; iPar++) {
+            pass[iPar] &= (chrg[iPar] != 0.f);
+          }
+        }
+
+        m_nAccept = 0;
+        for (size_t iPar = 0; iPar < nPar; iPar++) {
+          m_nAccept += pass[iPar];
+        }
+        return;
+
+      }  // end 'Select(SCorrelatorJetTreeMakerParticleTable&)'
+
+    private:
+
+      // members
+      size_t                              m_nAccept = 0;
+      vector<uint8_t>                     m_pass;
+      SCorrelatorJetTreeMakerParticleCuts m_cuts;
+
+  };  // end SCorrelatorJetTreeMakerParticleSelector
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerParticleTable.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERPARTICLETABLE_H
+#define SCORRELATORJETTREEMAKERPARTICLETABLE_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerParticleTable definition --------------------------
+
+  struct SCorrelatorJetTreeMakerParticleTable {
+
+    // particle kinematics
+    vector<double> pt;
+    vector<double> eta;
+    vector<double> px;
+    vector<double> py;
+    vector<double> pz;
+    vector<double> ene;
+
+    // particle species and ids
+    vector<float> charge;
+    vector<int>   pdg;
+    vector<int>   barcode;
+    vector<int>   embedID;
+
+
+
+    size_t Size() const {
+      return pt.size();
+    }  // end 'Size()'
+
+
+
+    size_t AddRow(const double rowPx, const double rowPy, const double rowPz, const double rowEne, const double rowEta) {
+
+      // pt is derived once here so the selection only reads
+      // columns; eta is taken as is from the generator (e.g.
+      // HepMC's momentum().eta()) so that particles at the
+      // acceptance edge are selected exactly as before
+      const double rowPt = sqrt((rowPx * rowPx) + (rowPy * rowPy));
+
+      const size_t iRow = Size();
+      pt.push_back(rowPt);
+      eta.push_back(rowEta);
+      px.push_back(rowPx);
+      py.push_back(rowPy);
+      pz.push_back(rowPz);
+      ene.push_back(rowEne);
+      charge.push_back(0.);
+      pdg.push_back(0);
+      barcode.push_back(-1);
+      embedID.push_back(0);
+      return iRow;
+
+    }  // end 'AddRow(double, double, double, double, double)'
+
+
+
+    void Reserve(const size_t nRow) {
+
+      pt.reserve(nRow);
+      eta.reserve(nRow);
+      px.reserve(nRow);
+      py.reserve(nRow);
+      pz.reserve(nRow);
+      ene.reserve(nRow);
+      charge.reserve(nRow);
+      pdg.reserve(nRow);
+      barcode.reserve(nRow);
+      embedID.reserve(nRow);
+      return;
+
+    }  // end 'Reserve(size_t)'
+
+
+
+    void Reset() {
+
+      // clear columns (capacity is kept between events)
+      pt.clear();
+      eta.clear();
+      px.clear();
+      py.clear();
+      pz.clear();
+      ene.clear();
+      charge.clear();
+      pdg.clear();
+      barcode.clear();
+      embedID.clear();
+      return;
+
+    }  // end 'Reset()'
+
+  };  // end SCorrelatorJetTreeMakerParticleTable
+
+
+
+  // SCorrelatorJetTreeMakerChargeTable definition ----------------------------
+
+  // Caches charges by PDG code: codes with |pdg| < NDense (all
+  // leptons, mesons, and baryons) sit in a flat array, anything
+  // else (e.g. nuclei) in a hash map. Misses are looked up once
+  // with the function passed to Build()
+
+  class SCorrelatorJetTreeMakerChargeTable {
+
+    public:
+
+      typedef function<float(const int)> ChargeFunc;
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerChargeTable()  {};
+      ~SCorrelatorJetTreeMakerChargeTable() {};
+
+      // getters
+      size_t GetNSparse() const {return m_sparse.size();}
+
+
+
+      void Build(ChargeFunc func) {
+
+        m_func = func;
+        m_dense.assign((2 * NDense) + 1, numeric_limits<float>::quiet_NaN());
+        m_sparse.clear();
+
+        // fill the most common final-state species up front
+        const vector<int> common = {
+          11, 12, 13, 14, 15, 16, 22,
+          111, 130, 211, 221, 310, 321, 411, 421, 431, 511, 521,
+          2112, 2212, 3112, 3122, 3212, 3222, 3312, 3322, 3334, 4122
+        };
+        for (const int code : common) {
+          Get(code);
+          Get(-code);
+        }
+        return;
+
+      }  // end 'Build(ChargeFunc)'
+
+
+
+      inline float Get(const int code) {
+
+        // dense codes: NaN marks not-yet-cached
+        if ((code > -NDense) && (code < NDense)) {
+          float& chrg = m_dense[code + NDense];
+          if (isnan(chrg)) chrg = m_func(code);
+          return chrg;
+        }
+
+        unordered_map<int, float>::const_iterator itChrg = m_sparse.find(code);
+        if (itChrg != m_sparse.end()) {
+          return itChrg -> second;
+        }
+        const float chrg = m_func(code);
+        m_sparse[code]   = chrg;
+        return chrg;
+
+      }  // end 'Get(int)'
+
+    private:
+
+      // codes below this are held in the flat array
+      static constexpr int NDense = 10000;
+
+      // members
+      ChargeFunc                m_func;
+      vector<float>             m_dense;
+      unordered_map<int, float> m_sparse;
+
+  };  // end SCorrelatorJetTreeMakerChargeTable
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerProvenance.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERPROVENANCE_H
+#define SCORRELATORJETTREEMAKERPROVENANCE_H
+
+// c++ utilities
+#include <vector>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerCstProvenance definition --------------------------
+
+  // Where each constituent of an event came from. Constituents carry
+  // their row as their user index; for the nominal constituents the
+  // row is also their position in the constituent vector. Columns are
+  // cleared (not freed) between events.
+
+  struct SCorrelatorJetTreeMakerCstProvenance {
+
+    // Jet::SRC of the constituent and its id there (barcode,
+    // track id, cluster id, etc.)
+    vector<int> source;
+    vector<int> sourceID;
+
+    // embedding ID (truth only, 0 otherwise) and barcode of
+    // the (matched) particle, -1 if there isn't one
+    vector<int> embedID;
+    vector<int> matchID;
+
+
+
+    size_t Size() const {
+      return source.size();
+    }  // end 'Size()'
+
+
+
+    int Add(const int rowSource, const int rowSourceID, const int rowEmbedID, const int rowMatchID) {
+
+      // returns the row, to be used as the user index
+      const int iRow = Size();
+      source.push_back(rowSource);
+      sourceID.push_back(rowSourceID);
+      embedID.push_back(rowEmbedID);
+      matchID.push_back(rowMatchID);
+      return iRow;
+
+    }  // end 'Add(int, int, int, int)'
+
+
+
+    int GetEmbedID(const int iRow) const {
+      return ((iRow >= 0) && ((size_t) iRow < Size())) ? embedID[iRow] : 0;
+    }  // end 'GetEmbedID(int)'
+
+
+
+    int GetMatchID(const int iRow) const {
+      return ((iRow >= 0) && ((size_t) iRow < Size())) ? matchID[iRow] : -1;
+    }  // end 'GetMatchID(int)'
+
+
+
+    void Reserve(const size_t nRow) {
+
+      source.reserve(nRow);
+      sourceID.reserve(nRow);
+      embedID.reserve(nRow);
+      matchID.reserve(nRow);
+      return;
+
+    }  // end 'Reserve(size_t)'
+
+
+
+    void Reset() {
+
+      // clear columns (capacity is kept between events)
+      source.clear();
+      sourceID.clear();
+      embedID.clear();
+      matchID.clear();
+      return;
+
+    }  // end 'Reset()'
+
+  };  // end SCorrelatorJetTreeMakerCstProvenance
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
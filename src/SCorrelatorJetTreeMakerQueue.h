@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerQueue.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERQUEUE_H
+#define SCORRELATORJETTREEMAKERQUEUE_H
+
+// c++ utilities
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <condition_variable>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerQueue definition ----------------------------------
+
+  template <typename T> class SCorrelatorJetTreeMakerQueue {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerQueue() {};
+      SCorrelatorJetTreeMakerQueue(const size_t capacity) : m_capacity(capacity) {};
+      ~SCorrelatorJetTreeMakerQueue() {};
+
+      // setters
+      void SetCapacity(const size_t capacity) {m_capacity = capacity;}
+
+
+
+      // blocks while the queue is full (backpressure on the producer);
+      // returns false if the queue was closed in the meantime
+      bool Push(T&& item) {
+
+        unique_lock<mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this] {return m_isClosed || (m_items.size() < m_capacity);});
+        if (m_isClosed) return false;
+
+        m_items.push_back(move(item));
+        lock.unlock();
+        m_notEmpty.notify_one();
+        return true;
+
+      }  // end 'Push(T&&)'
+
+
+
+      // blocks until an item is available; returns false once
+      // the queue is closed and fully drained
+      bool Pop(T& item) {
+
+        unique_lock<mutex> lock(m_mutex);
+        m_notEmpty.wait(lock, [this] {return m_isClosed || !m_items.empty();});
+        if (m_items.empty()) return false;
+
+        item = move(m_items.front());
+        m_items.pop_front();
+        lock.unlock();
+        m_notFull.notify_one();
+        return true;
+
+      }  // end 'Pop(T&)'
+
+
+
+      // non-blocking versions: return false (and leave
+      // the item alone) if the queue is full/empty
+      bool TryPush(T&& item) {
+
+        unique_lock<mutex> lock(m_mutex);
+        if (m_isClosed || (m_items.size() >= m_capacity)) return false;
+
+        m_items.push_back(move(item));
+        lock.unlock();
+        m_notEmpty.notify_one();
+        return true;
+
+      }  // end 'TryPush(T&&)'
+
+
+
+      bool TryPop(T& item) {
+
+        unique_lock<mutex> lock(m_mutex);
+        if (m_items.empty()) return false;
+
+        item = move(m_items.front());
+        m_items.pop_front();
+        lock.unlock();
+        m_notFull.notify_one();
+        return true;
+
+      }  // end 'TryPop(T&)'
+
+
+
+      // no more items will be pushed: wakes up everyone waiting
+      void Close() {
+
+        {
+          lock_guard<mutex> lock(m_mutex);
+          m_isClosed = true;
+        }
+        m_notEmpty.notify_all();
+        m_notFull.notify_all();
+        return;
+
+      }  // end 'Close()'
+
+
+
+      void Open() {
+
+        lock_guard<mutex> lock(m_mutex);
+        m_items.clear();
+        m_isClosed = false;
+        return;
+
+      }  // end 'Open()'
+
+    private:
+
+      // members
+      bool               m_isClosed = false;
+      size_t             m_capacity = 64;
+      deque<T>           m_items;
+      mutex              m_mutex;
+      condition_variable m_notEmpty;
+      condition_variable m_notFull;
+
+  };  // end SCorrelatorJetTreeMakerQueue
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,126 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerSnapshot.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERSNAPSHOT_H
+#define SCORRELATORJETTREEMAKERSNAPSHOT_H
+
+// c++ utilities
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// root libraries
+#include <TTree.h>
+// fastjet libraries
+#include <fastjet/PseudoJet.hh>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerOutput.h"
+#include "SCorrelatorJetTreeMakerProvenance.h"
+
+// make common namespaces implicit
+using namespace std;
+using namespace fastjet;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerEventInfo definition ------------------------------
+
+  struct SCorrelatorJetTreeMakerEventInfo {
+
+    // reco event variables
+    int    nTrks    = numeric_limits<int>::max();
+    double eSumECal = numeric_limits<double>::max();
+    double eSumHCal = numeric_limits<double>::max();
+    double recoVtxX = numeric_limits<double>::max();
+    double recoVtxY = numeric_limits<double>::max();
+    double recoVtxZ = numeric_limits<double>::max();
+
+    // truth event variables
+    int    nChrgPars = numeric_limits<int>::max();
+    double eSumPar   = numeric_limits<double>::max();
+    double trueVtxX  = numeric_limits<double>::max();
+    double trueVtxY  = numeric_limits<double>::max();
+    double trueVtxZ  = numeric_limits<double>::max();
+
+    // parton variables
+    pair<int, int>       partonID = {numeric_limits<int>::max(),    numeric_limits<int>::max()};
+    pair<double, double> partonPX = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double> partonPY = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+    pair<double, double> partonPZ = {numeric_limits<double>::max(), numeric_limits<double>::max()};
+
+    // provenance of constituents (indexed by user index)
+    const SCorrelatorJetTreeMakerCstProvenance* recoProv = NULL;
+    const SCorrelatorJetTreeMakerCstProvenance* trueProv = NULL;
+
+
+
+    int GetTrueCstID(const int iCst) const {
+      if (!trueProv || (iCst < 0) || ((size_t) iCst >= trueProv -> Size())) return -1;
+      return trueProv -> sourceID[iCst];
+    }  // end 'GetTrueCstID(int)'
+
+
+
+    int GetTrueEmbedID(const int iCst) const {
+      return trueProv ? trueProv -> GetEmbedID(iCst) : 0;
+    }  // end 'GetTrueEmbedID(int)'
+
+
+
+    int GetRecoMatchID(const int iCst) const {
+      return recoProv ? recoProv -> GetMatchID(iCst) : -1;
+    }  // end 'GetRecoMatchID(int)'
+
+  };  // end SCorrelatorJetTreeMakerEventInfo
+
+
+
+  // SCorrelatorJetTreeMakerEventSnapshot definition --------------------------
+
+  struct SCorrelatorJetTreeMakerEventSnapshot {
+
+    // position of event in input, used to restore order on output
+    uint64_t index = 0;
+
+    // event variables and constituents: plain momenta and ids only
+    // so that a snapshot doesn't depend on the node tree
+    SCorrelatorJetTreeMakerEventInfo     info;
+    vector<PseudoJet>                    recoCsts;
+    vector<PseudoJet>                    trueCsts;
+    SCorrelatorJetTreeMakerCstProvenance recoProv;
+    SCorrelatorJetTreeMakerCstProvenance trueProv;
+
+  };  // end SCorrelatorJetTreeMakerEventSnapshot
+
+
+
+  // SCorrelatorJetTreeMakerEventRecord definition ----------------------------
+
+  struct SCorrelatorJetTreeMakerEventRecord {
+
+    // position of event in input
+    uint64_t index = 0;
+
+    // one entry per jet configuration (only the requested layout is filled)
+    vector<SCorrelatorJetTreeMakerLegacyRecoOutput>  recoOutputs;
+    vector<SCorrelatorJetTreeMakerLegacyTruthOutput> trueOutputs;
+    vector<SCorrelatorJetTreeMakerFlatRecoOutput>    recoFlatOutputs;
+    vector<SCorrelatorJetTreeMakerFlatTruthOutput>   trueFlatOutputs;
+
+  };  // end SCorrelatorJetTreeMakerEventRecord
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
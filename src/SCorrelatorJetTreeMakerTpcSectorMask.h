@@ -0,0 +1,262 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerTpcSectorMask.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERTPCSECTORMASK_H
+#define SCORRELATORJETTREEMAKERTPCSECTORMASK_H
+
+// c++ utilities
+#include <map>
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <iostream>
+#include <algorithm>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerTpcSectorConfig definition ------------------------
+
+  struct SCorrelatorJetTreeMakerTpcSectorConfig {
+
+    // tracks within boundary +- (maskWidth / 2) are rejected
+    float maskWidth = 0.01;
+
+    // TPC sector boundaries: 12 sectors --> ~0.523 rad/sector,
+    // assumed to be symmetric about phi = 0
+    array<float, 12> boundaries = {
+      -2.877, -2.354, -1.831, -1.308, -0.785, -0.262,
+       0.262,  0.785,  1.308,  1.831,  2.354,  2.877
+    };
+
+    // sector i lies between boundaries i and i + 1 (sector 11
+    // wraps around phi = +-pi), all tracks in a dead sector
+    // are rejected
+    vector<int> deadSectors;
+
+  };  // end SCorrelatorJetTreeMakerTpcSectorConfig
+
+
+
+  // SCorrelatorJetTreeMakerTpcSectorMask definition --------------------------
+
+  class SCorrelatorJetTreeMakerTpcSectorMask {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerTpcSectorMask() {Build();};
+      SCorrelatorJetTreeMakerTpcSectorMask(const SCorrelatorJetTreeMakerTpcSectorConfig& config) : m_config(config) {Build();};
+      ~SCorrelatorJetTreeMakerTpcSectorMask() {};
+
+      // setters
+      void SetConfig(const SCorrelatorJetTreeMakerTpcSectorConfig& config) {m_config = config; Build();}
+      void SetDeadSectors(const vector<int>& sectors)                     {m_config.deadSectors = sectors; Build();}
+
+      // getters
+      size_t                                        GetNIntervals() const {return m_lo.size();}
+      const SCorrelatorJetTreeMakerTpcSectorConfig& GetConfig()     const {return m_config;}
+
+
+
+      inline bool IsGood(const double phi) const {
+
+        // most bins are either entirely masked or entirely
+        // clear, only bins with an interval edge are checked
+        // against the intervals themselves
+        const double pos = (phi + M_PI) * m_invBinWidth;
+        if ((pos >= 0.) && (pos < NBins)) {
+          const uint8_t state = m_lut[static_cast<size_t>(pos)];
+          if (state != EDGE) return (state == CLEAR);
+        }
+
+        bool isGood = true;
+        for (size_t iInt = 0; iInt < m_lo.size(); iInt++) {
+          isGood &= !((phi > m_lo[iInt]) & (phi < m_hi[iInt]));
+        }
+        return isGood;
+
+      }  // end 'IsGood(double)'
+
+
+
+      void Apply(const double* phi, const size_t nTrk, uint8_t* pass) const {
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          pass[iTrk] &= IsGood(phi[iTrk]);
+        }
+        return;
+      }  // end 'Apply(double*, size_t, uint8_t*)'
+
+    private:
+
+      // lookup table binning: ~1.5 mrad per bin
+      enum LUT {CLEAR = 0, MASKED = 1, EDGE = 2};
+      static constexpr size_t NBins = 4096;
+
+
+
+      void Build() {
+
+        const double halfWidth = m_config.maskWidth / 2.;
+        const size_t nBound    = m_config.boundaries.size();
+
+        // collect masked (open) intervals: sector boundaries
+        // first, then dead sectors (plus their boundaries)
+        vector<pair<double, double>> intervals;
+        for (const float boundary : m_config.boundaries) {
+          intervals.push_back( make_pair(boundary - halfWidth, boundary + halfWidth) );
+        }
+        for (const int sector : m_config.deadSectors) {
+          if ((sector < 0) || (sector >= (int) nBound)) {
+            cerr << "SCorrelatorJetTreeMakerTpcSectorMask::Build() WARNING: sector " << sector << " doesn't exist! Ignoring." << endl;
+            continue;
+          }
+          const double lo = m_config.boundaries[sector];
+          const double hi = (sector + 1 < (int) nBound) ? m_config.boundaries[sector + 1] : m_config.boundaries[0] + (2. * M_PI);
+          intervals.push_back( make_pair(lo - halfWidth, hi + halfWidth) );
+        }
+
+        // fold anything past +-pi back into range
+        m_lo.clear();
+        m_hi.clear();
+        for (const pair<double, double>& interval : intervals) {
+          m_lo.push_back(interval.first);
+          m_hi.push_back(interval.second);
+          if (interval.second > M_PI) {
+            m_lo.push_back(interval.first  - (2. * M_PI));
+            m_hi.push_back(interval.second - (2. * M_PI));
+          }
+          if (interval.first < -M_PI) {
+            m_lo.push_back(interval.first  + (2. * M_PI));
+            m_hi.push_back(interval.second + (2. * M_PI));
+          }
+        }
+
+        // mark bins as masked if they lie inside an interval,
+        // or as edges if an interval starts or ends in them
+        const double binWidth = (2. * M_PI) / NBins;
+        m_invBinWidth = 1. / binWidth;
+        m_lut.assign(NBins, CLEAR);
+        for (size_t iInt = 0; iInt < m_lo.size(); iInt++) {
+          const double posLo = (m_lo[iInt] + M_PI) * m_invBinWidth;
+          const double posHi = (m_hi[iInt] + M_PI) * m_invBinWidth;
+          const long   binLo = max(0L, (long) floor(posLo));
+          const long   binHi = min((long) NBins - 1, (long) floor(posHi));
+          for (long iBin = binLo; iBin <= binHi; iBin++) {
+            const bool isEdge = (iBin == (long) floor(posLo)) || (iBin == (long) floor(posHi));
+            if (isEdge) {
+              m_lut[iBin] = EDGE;
+            } else if (m_lut[iBin] == CLEAR) {
+              m_lut[iBin] = MASKED;
+            }
+          }
+        }
+        return;
+
+      }  // end 'Build()'
+
+      // members
+      double                                 m_invBinWidth = 1.;
+      vector<double>                         m_lo;
+      vector<double>                         m_hi;
+      vector<uint8_t>                        m_lut;
+      SCorrelatorJetTreeMakerTpcSectorConfig m_config;
+
+  };  // end SCorrelatorJetTreeMakerTpcSectorMask
+
+
+
+  // SCorrelatorJetTreeMakerTpcDeadSectorTable definition ---------------------
+
+  // Dead sectors by run: each entry holds from its run until the
+  // next entry's run. Text files have one entry per line,
+  //   <first run> <dead sector> <dead sector> ...
+  // where '#' starts a comment.
+
+  class SCorrelatorJetTreeMakerTpcDeadSectorTable {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerTpcDeadSectorTable()  {};
+      ~SCorrelatorJetTreeMakerTpcDeadSectorTable() {};
+
+      // getters
+      bool   IsEmpty()     const {return m_table.empty();}
+      size_t GetNEntries() const {return m_table.size();}
+
+      void Add(const int firstRun, const vector<int>& sectors) {
+        m_table[firstRun] = sectors;
+        return;
+      }  // end 'Add(int, vector<int>&)'
+
+
+
+      bool Load(const string& fileName) {
+
+        ifstream file(fileName);
+        if (!file.is_open()) {
+          cerr << "SCorrelatorJetTreeMakerTpcDeadSectorTable::Load(string) PANIC: couldn't open '" << fileName << "'!" << endl;
+          return false;
+        }
+
+        string line;
+        while (getline(file, line)) {
+          line = line.substr(0, line.find('#'));
+
+          int           run;
+          istringstream stream(line);
+          if (!(stream >> run)) continue;
+
+          int         sector;
+          vector<int> sectors;
+          while (stream >> sector) {
+            sectors.push_back(sector);
+          }
+          Add(run, sectors);
+        }
+        return true;
+
+      }  // end 'Load(string&)'
+
+
+
+      vector<int> GetDeadSectors(const int run) const {
+
+        // runs before the first entry have no dead sectors
+        map<int, vector<int>>::const_iterator itEntry = m_table.upper_bound(run);
+        if (itEntry == m_table.begin()) {
+          return vector<int>();
+        }
+        return (--itEntry) -> second;
+
+      }  // end 'GetDeadSectors(int)'
+
+    private:
+
+      map<int, vector<int>> m_table;
+
+  };  // end SCorrelatorJetTreeMakerTpcDeadSectorTable
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerTrackSelector.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERTRACKSELECTOR_H
+#define SCORRELATORJETTREEMAKERTRACKSELECTOR_H
+
+// c++ utilities
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis definitions
+#include "SCorrelatorJetTreeMakerTrackTable.h"
+#include "SCorrelatorJetTreeMakerTpcSectorMask.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerDcaSigmaModel definition --------------------------
+
+  struct SCorrelatorJetTreeMakerDcaSigmaModel {
+
+    // parameters of sigma(pt) = [0] + [1]/pt + [2]/pt^2; above
+    // ptMax (max pt of the fit) the value at ptMax is used
+    array<double, 3> par   = {1., 1., 1.};
+    double           ptMax = 15.;
+
+
+
+    static string GetFormula() {
+      return "[0]+[1]/x+[2]/(x*x)";
+    }  // end 'GetFormula()'
+
+
+
+    inline double Eval(const double pt) const {
+      const double x = (pt > ptMax) ? ptMax : pt;
+      return par[0] + (par[1] / x) + (par[2] / (x * x));
+    }  // end 'Eval(double)'
+
+  };  // end SCorrelatorJetTreeMakerDcaSigmaModel
+
+
+
+  // SCorrelatorJetTreeMakerTrackCuts definition ------------------------------
+
+  struct SCorrelatorJetTreeMakerTrackCuts {
+
+    // flags
+    bool requireSiSeeds = true;
+    bool doVtxCut       = false;
+    bool useOnlyPrimVtx = true;
+    bool doDcaSigmaCut  = false;
+    bool maskTpcSectors = false;
+
+    // ranges
+    pair<double, double> vzRange      = {-10., 10.};
+    pair<double, double> vrRange      = {0.0,  0.418};
+    pair<double, double> ptRange      = {0.1,  100.};
+    pair<double, double> etaRange     = {-1.1, 1.1};
+    pair<double, double> qualRange    = {-1.,  10.};
+    pair<double, double> nMvtxRange   = {2.,   100.};
+    pair<double, double> nInttRange   = {1.,   100.};
+    pair<double, double> nTpcRange    = {25.,  100.};
+    pair<double, double> dcaRangeXY   = {-5.,  5.};
+    pair<double, double> dcaRangeZ    = {-5.,  5.};
+    pair<double, double> deltaPtRange = {0.,   0.5};
+
+    // for pt-dependent dca cuts
+    double                               nSigCutXY = 1.;
+    double                               nSigCutZ  = 1.;
+    SCorrelatorJetTreeMakerDcaSigmaModel sigDcaXY;
+    SCorrelatorJetTreeMakerDcaSigmaModel sigDcaZ;
+
+    // tpc sector boundaries and dead sectors
+    SCorrelatorJetTreeMakerTpcSectorConfig tpcSectors;
+
+  };  // end SCorrelatorJetTreeMakerTrackCuts
+
+
+
+  // SCorrelatorJetTreeMakerTrackCutVariation definition ----------------------
+
+  // A named set of track cuts (typically the nominal cuts with one range
+  // changed) whose reco jets are found and written alongside the nominal
+  // ones, e.g. for tracking systematics
+
+  struct SCorrelatorJetTreeMakerTrackCutVariation {
+
+    string                           name = "";
+    SCorrelatorJetTreeMakerTrackCuts cuts;
+
+  };  // end SCorrelatorJetTreeMakerTrackCutVariation
+
+
+
+  // SCorrelatorJetTreeMakerTrackSelector definition --------------------------
+
+  class SCorrelatorJetTreeMakerTrackSelector {
+
+    public:
+
+      // ctor/dtor
+      SCorrelatorJetTreeMakerTrackSelector() {};
+      SCorrelatorJetTreeMakerTrackSelector(const SCorrelatorJetTreeMakerTrackCuts& cuts) : m_cuts(cuts), m_tpcMask(cuts.tpcSectors) {};
+      ~SCorrelatorJetTreeMakerTrackSelector() {};
+
+      // setters
+      void SetCuts(const SCorrelatorJetTreeMakerTrackCuts& cuts) {m_cuts = cuts; m_tpcMask.SetConfig(cuts.tpcSectors);}
+      void SetDeadTpcSectors(const vector<int>& sectors)        {m_cuts.tpcSectors.deadSectors = sectors; m_tpcMask.SetDeadSectors(sectors);}
+
+      // getters
+      size_t                                      GetNAccepted() const {return m_nAccept;}
+      const vector<uint64_t>&                     GetMask()      const {return m_mask;}
+      const SCorrelatorJetTreeMakerTrackCuts&     GetCuts()      const {return m_cuts;}
+      const SCorrelatorJetTreeMakerTpcSectorMask& GetTpcMask()   const {return m_tpcMask;}
+
+      bool IsAccepted(const size_t iTrk) const {
+        return (m_mask[iTrk >> 6] >> (iTrk & 63)) & 1;
+      }
+
+
+
+      const vector<uint64_t>& Select(const SCorrelatorJetTreeMakerTrackTable& table) {
+
+        // size work buffer
+        const size_t nTrk = table.Size();
+        m_pass.assign(nTrk, 1);
+        uint8_t* pass = m_pass.data();
+
+        // seed, kinematic, and quality cuts
+        PassSeeds(table.hasSiSeed.data(), table.hasTpcSeed.data(), nTrk, m_cuts.requireSiSeeds, pass);
+        PassOpenRange(table.pt.data(),      nTrk, m_cuts.ptRange,      pass);
+        PassOpenRange(table.eta.data(),     nTrk, m_cuts.etaRange,     pass);
+        PassOpenRange(table.quality.data(), nTrk, m_cuts.qualRange,    pass);
+        PassOpenRange(table.deltaPt.data(), nTrk, m_cuts.deltaPtRange, pass);
+        PassCountRange(table.nMvtx.data(),  nTrk, m_cuts.nMvtxRange,   pass);
+        PassCountRange(table.nIntt.data(),  nTrk, m_cuts.nInttRange,   pass);
+        PassCountRange(table.nTpc.data(),   nTrk, m_cuts.nTpcRange,    pass);
+
+        // dca cuts: pt-dependent widths are evaluated in-line
+        if (m_cuts.doDcaSigmaCut) {
+          PassSigma(table.dcaXY.data(), table.pt.data(), nTrk, m_cuts.nSigCutXY, m_cuts.sigDcaXY, pass);
+          PassSigma(table.dcaZ.data(),  table.pt.data(), nTrk, m_cuts.nSigCutZ,  m_cuts.sigDcaZ,  pass);
+        } else {
+          PassOpenRange(table.dcaXY.data(), nTrk, m_cuts.dcaRangeXY, pass);
+          PassOpenRange(table.dcaZ.data(),  nTrk, m_cuts.dcaRangeZ,  pass);
+        }
+
+        // vertex cuts
+        if (m_cuts.doVtxCut) {
+          PassVertex(table.vtxX.data(), table.vtxY.data(), table.vtxZ.data(), nTrk, pass);
+        }
+        if (m_cuts.useOnlyPrimVtx) {
+          PassFlag(table.isFromPrimVtx.data(), nTrk, pass);
+        }
+
+        // tpc sector boundaries and dead sectors
+        if (m_cuts.maskTpcSectors) {
+          m_tpcMask.Apply(table.phi.data(), nTrk, pass);
+        }
+
+        // pack into bitmask
+        Pack(nTrk);
+        return m_mask;
+
+      }  // end 'Select(SCorrelatorJetTreeMakerTrackTable&)'
+
+    private:
+
+      // each pass ANDs one cut into the work buffer without branching
+      // so that the loops can be auto-vectorized. comparisons are
+      // written exactly as in IsGoodTrack(size_t) to keep the
+      // selection bit-identical to the scalar path
+
+      static void PassFlag(const uint8_t* flag, const size_t nTrk, uint8_t* pass) {
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          pass[iTrk] &= (flag[iTrk] != 0);
+        }
+        return;
+      }  // end 'PassFlag(uint8_t*, size_t, uint8_t*)'
+
+
+
+      static void PassSeeds(const uint8_t* siSeed, const uint8_t* tpcSeed, const size_t nTrk, const bool requireBoth, uint8_t* pass) {
+        if (requireBoth) {
+          for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+            pass[iTrk] &= ((siSeed[iTrk] != 0) & (tpcSeed[iTrk] != 0));
+          }
+        } else {
+          for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+            pass[iTrk] &= ((siSeed[iTrk] != 0) | (tpcSeed[iTrk] != 0));
+          }
+        }
+        return;
+      }  // end 'PassSeeds(uint8_t*, uint8_t*, size_t, bool, uint8_t*)'
+
+
+
+      static void PassOpenRange(const double* val, const size_t nTrk, const pair<double, double> range, uint8_t* pass) {
+        const double lo = range.first;
+        const double hi = range.second;
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          pass[iTrk] &= ((val[iTrk] > lo) & (val[iTrk] < hi));
+        }
+        return;
+      }  // end 'PassOpenRange(double*, size_t, pair<double, double>, uint8_t*)'
+
+
+
+      static void PassCountRange(const int* val, const size_t nTrk, const pair<double, double> range, uint8_t* pass) {
+        const double lo = range.first;
+        const double hi = range.second;
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          const double num = val[iTrk];
+          pass[iTrk] &= ((num > lo) & (num <= hi));
+        }
+        return;
+      }  // end 'PassCountRange(int*, size_t, pair<double, double>, uint8_t*)'
+
+
+
+      static void PassSigma(const double* dca, const double* pt, const size_t nTrk, const double nSig, const SCorrelatorJetTreeMakerDcaSigmaModel& model, uint8_t* pass) {
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          pass[iTrk] &= (abs(dca[iTrk]) < (nSig * model.Eval(pt[iTrk])));
+        }
+        return;
+      }  // end 'PassSigma(double*, double*, size_t, double, SCorrelatorJetTreeMakerDcaSigmaModel&, uint8_t*)'
+
+
+
+      void PassVertex(const double* vx, const double* vy, const double* vz, const size_t nTrk, uint8_t* pass) const {
+        const double vzLo = m_cuts.vzRange.first;
+        const double vzHi = m_cuts.vzRange.second;
+        const double vrLo = m_cuts.vrRange.first;
+        const double vrHi = m_cuts.vrRange.second;
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          const double vr = sqrt((vx[iTrk] * vx[iTrk]) + (vy[iTrk] * vy[iTrk]));
+          pass[iTrk] &= ((vz[iTrk] > vzLo) & (vz[iTrk] < vzHi) & (abs(vr) > vrLo) & (abs(vr) < vrHi));
+        }
+        return;
+      }  // end 'PassVertex(double*, double*, double*, size_t, uint8_t*)'
+
+
+
+      void Pack(const size_t nTrk) {
+        m_nAccept = 0;
+        m_mask.assign((nTrk + 63) >> 6, 0);
+        for (size_t iTrk = 0; iTrk < nTrk; iTrk++) {
+          m_mask[iTrk >> 6] |= (static_cast<uint64_t>(m_pass[iTrk]) << (iTrk & 63));
+          m_nAccept         += m_pass[iTrk];
+        }
+        return;
+      }  // end 'Pack(size_t)'
+
+      // members
+      size_t                               m_nAccept = 0;
+      vector<uint8_t>                      m_pass;
+      vector<uint64_t>                     m_mask;
+      SCorrelatorJetTreeMakerTrackCuts     m_cuts;
+      SCorrelatorJetTreeMakerTpcSectorMask m_tpcMask;
+
+  };  // end SCorrelatorJetTreeMakerTrackSelector
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerTrackTable.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERTRACKTABLE_H
+#define SCORRELATORJETTREEMAKERTRACKTABLE_H
+
+// c++ utilities
+#include <vector>
+#include <cstdint>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerTrackTable definition -----------------------------
+
+  struct SCorrelatorJetTreeMakerTrackTable {
+
+    // track kinematics
+    vector<double> pt;
+    vector<double> eta;
+    vector<double> phi;
+    vector<double> px;
+    vector<double> py;
+    vector<double> pz;
+    vector<double> ene;
+
+    // track quality
+    vector<double> quality;
+    vector<double> dcaXY;
+    vector<double> dcaZ;
+    vector<double> deltaPt;
+    vector<int>    nMvtx;
+    vector<int>    nIntt;
+    vector<int>    nTpc;
+
+    // track seeds and vertex
+    vector<uint8_t> hasSiSeed;
+    vector<uint8_t> hasTpcSeed;
+    vector<uint8_t> isFromPrimVtx;
+    vector<int>     vtxID;
+    vector<double>  vtxX;
+    vector<double>  vtxY;
+    vector<double>  vtxZ;
+
+    // track and matching particle ids
+    vector<int> trkID;
+    vector<int> matchID;
+
+
+
+    size_t Size() const {
+      return pt.size();
+    }  // end 'Size()'
+
+
+
+    size_t AddRow() {
+
+      // grow every column by one and return index of new row
+      const size_t iRow = Size();
+      const size_t nRow = iRow + 1;
+      pt.resize(nRow);
+      eta.resize(nRow);
+      phi.resize(nRow);
+      px.resize(nRow);
+      py.resize(nRow);
+      pz.resize(nRow);
+      ene.resize(nRow);
+      quality.resize(nRow);
+      dcaXY.resize(nRow);
+      dcaZ.resize(nRow);
+      deltaPt.resize(nRow);
+      nMvtx.resize(nRow);
+      nIntt.resize(nRow);
+      nTpc.resize(nRow);
+      hasSiSeed.resize(nRow);
+      hasTpcSeed.resize(nRow);
+      isFromPrimVtx.resize(nRow);
+      vtxID.resize(nRow);
+      vtxX.resize(nRow);
+      vtxY.resize(nRow);
+      vtxZ.resize(nRow);
+      trkID.resize(nRow);
+      matchID.resize(nRow, -1);
+      return iRow;
+
+    }  // end 'AddRow()'
+
+
+
+    void Reserve(const size_t nRow) {
+
+      pt.reserve(nRow);
+      eta.reserve(nRow);
+      phi.reserve(nRow);
+      px.reserve(nRow);
+      py.reserve(nRow);
+      pz.reserve(nRow);
+      ene.reserve(nRow);
+      quality.reserve(nRow);
+      dcaXY.reserve(nRow);
+      dcaZ.reserve(nRow);
+      deltaPt.reserve(nRow);
+      nMvtx.reserve(nRow);
+      nIntt.reserve(nRow);
+      nTpc.reserve(nRow);
+      hasSiSeed.reserve(nRow);
+      hasTpcSeed.reserve(nRow);
+      isFromPrimVtx.reserve(nRow);
+      vtxID.reserve(nRow);
+      vtxX.reserve(nRow);
+      vtxY.reserve(nRow);
+      vtxZ.reserve(nRow);
+      trkID.reserve(nRow);
+      matchID.reserve(nRow);
+      return;
+
+    }  // end 'Reserve(size_t)'
+
+
+
+    void Reset() {
+
+      // clear columns (capacity is kept between events)
+      pt.clear();
+      eta.clear();
+      phi.clear();
+      px.clear();
+      py.clear();
+      pz.clear();
+      ene.clear();
+      quality.clear();
+      dcaXY.clear();
+      dcaZ.clear();
+      deltaPt.clear();
+      nMvtx.clear();
+      nIntt.clear();
+      nTpc.clear();
+      hasSiSeed.clear();
+      hasTpcSeed.clear();
+      isFromPrimVtx.clear();
+      vtxID.clear();
+      vtxX.clear();
+      vtxY.clear();
+      vtxZ.clear();
+      trkID.clear();
+      matchID.clear();
+      return;
+
+    }  // end 'Reset()'
+
+  };  // end SCorrelatorJetTreeMakerTrackTable
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// 'SCorrelatorJetTreeMakerWriteConfig.h'
+// Derek Anderson
+// 10.15.2026
+//
+// A module to produce a tree of jets for the sPHENIX
+// Cold QCD Energy-Energy Correlator analysis.
+//
+// Derived from code by Antonio Silva (thanks!!)
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORJETTREEMAKERWRITECONFIG_H
+#define SCORRELATORJETTREEMAKERWRITECONFIG_H
+
+// c++ utilities
+#include <string>
+// root libraries
+#include <TFile.h>
+#include <TTree.h>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SCorrelatorJetTreeMakerWriteConfig definition ----------------------------
+
+  struct SCorrelatorJetTreeMakerWriteConfig {
+
+    // compression algorithms (values follow ROOT::RCompressionSetting::EAlgorithm)
+    enum COMP {DEFAULT = 0, ZLIB = 1, LZMA = 2, LZ4 = 4, ZSTD = 5};
+
+    // anything left at 0 keeps the ROOT default; for auto-flush and
+    // auto-save, > 0 means no. of entries and < 0 means no. of bytes
+    // (auto-flush also sets the cluster size seen by readers)
+    COMP      compAlgo   = COMP::DEFAULT;
+    int       compLevel  = 0;
+    int       basketSize = 0;
+    long long autoFlush  = 0;
+    long long autoSave   = 0;
+
+
+
+    int GetCompressionSettings() const {
+      return (100 * compAlgo) + compLevel;
+    }  // end 'GetCompressionSettings()'
+
+
+
+    void Apply(TFile* file) const {
+
+      // has to be done before any trees are written
+      if (compAlgo != COMP::DEFAULT) {
+        file -> SetCompressionSettings(GetCompressionSettings());
+      }
+      return;
+
+    }  // end 'Apply(TFile*)'
+
+
+
+    void Apply(TTree* tree) const {
+
+      // basket size only applies to branches which already
+      // exist, so this has to be called after they're booked
+      if (basketSize > 0) {
+        tree -> SetBasketSize("*", basketSize);
+      }
+      if (autoFlush != 0) {
+        tree -> SetAutoFlush(autoFlush);
+      }
+      if (autoSave != 0) {
+        tree -> SetAutoSave(autoSave);
+      }
+      return;
+
+    }  // end 'Apply(TTree*)'
+
+
+
+    string MakeTag() const {
+
+      // compression label, e.g. ZSTD level 5 --> "ZSTD_Level5"
+      string compTag;
+      switch (compAlgo) {
+        case COMP::ZLIB:
+          compTag = "ZLIB";
+          break;
+        case COMP::LZMA:
+          compTag = "LZMA";
+          break;
+        case COMP::LZ4:
+          compTag = "LZ4";
+          break;
+        case COMP::ZSTD:
+          compTag = "ZSTD";
+          break;
+        default:
+          compTag = "Default";
+          break;
+      }
+      if (compAlgo != COMP::DEFAULT) {
+        compTag += "_Level" + to_string(compLevel);
+      }
+
+      // basket and cluster labels, only if changed
+      string tag = compTag;
+      if (basketSize > 0) tag += "_Basket" + to_string(basketSize);
+      if (autoFlush != 0) tag += "_Flush"  + to_string(autoFlush);
+      if (autoSave  != 0) tag += "_Save"   + to_string(autoSave);
+      return tag;
+
+    }  // end 'MakeTag()'
+
+  };  // end SCorrelatorJetTreeMakerWriteConfig
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------